@@ -1,6 +1,42 @@
 # Custom makefile by Voidless7125 (7/16/2024)
 # VEXcode mkrules.mk 2019_03_26_01
 
+# Runtime support for the slim profile
+ifeq ($(SLIM),1)
+OBJ += $(BUILD)/vex/vex_slimrt.o
+endif
+
+# Device input wrappers for the input log
+ifeq ($(INPUTLOG),1)
+OBJ += $(BUILD)/vex/vex_inputlog.o
+endif
+
+# Interrupt sampling for the profiler
+ifeq ($(PROFILER),1)
+OBJ += $(BUILD)/vex/vex_profiler.o
+endif
+
+# Sprite assets converted by the host spritegen tool
+ifneq ($(SPRITEGEN),)
+SRC_S = $(wildcard assets/*.bmp) $(wildcard assets/*.ppm)
+OBJ += $(addprefix $(BUILD)/, $(addsuffix .o, $(basename $(SRC_S))))
+.PRECIOUS: $(BUILD)/assets/%.c
+
+$(BUILD)/assets/%.c: assets/%.bmp
+	$(Q)$(MKDIR)
+	$(ECHO) "SPR $<"
+	$(Q)$(SPRITEGEN) -o $@ $<
+
+$(BUILD)/assets/%.c: assets/%.ppm
+	$(Q)$(MKDIR)
+	$(ECHO) "SPR $<"
+	$(Q)$(SPRITEGEN) -o $@ $<
+
+$(BUILD)/assets/%.o: $(BUILD)/assets/%.c
+	$(ECHO) "CC  $<"
+	$(Q)$(CC) $(CFLAGS) $(INC) -c -o $@ $<
+endif
+
 # Compile C files
 $(BUILD)/%.o: %.c $(SRC_H)
 	$(Q)$(MKDIR)
@@ -14,9 +50,10 @@ $(BUILD)/%.o: %.cpp $(SRC_H) $(SRC_A)
 	$(Q)$(CXX) $(CXX_FLAGS) $(INC) -c -o $@ $<
 	
 # Create executable 
-$(BUILD)/$(PROJECT).elf: $(OBJ)
+$(BUILD)/$(PROJECT).elf: $(OBJ) $(ORDER_FILE)
 	$(ECHO) "LINK $@"
-	$(Q)$(LINK) $(LNK_FLAGS) -o $@ $^ $(LIBS)
+	$(if $(ORDER_FILE),$(file >$(LSCRIPT),$(ORDER_SCRIPT)))
+	$(Q)$(LINK) $(LNK_FLAGS) -o $@ $(filter %.o,$^) $(LIBS)
 	$(Q)$(SIZE) $@
 
 # Create binary 
@@ -0,0 +1,272 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_inputlog.cpp                                            */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_inputlog.cpp
+ * @brief   Device input wrappers for the INPUTLOG=1 build
+ * @details
+ *  Only linked when building with INPUTLOG=1, the linker is then given
+ *  --wrap=name for every function in INPUTLOG_FUNCTIONS, so calls to name
+ *  reach __wrap_name here and __real_name is the VEXos function.  Each
+ *  wrapper asks vex::inputlog for a replayed value, otherwise calls the real
+ *  function and hands the result to vex::inputlog to record.
+ */
+/*---------------------------------------------------------------------------*/
+
+#include "v5_cpp.h"
+
+using namespace vex;
+using namespace vex::inputlogformat;
+
+#define INPUTLOG_WRAP_DEV(name, R, T)                                                 \
+  extern "C" R __real_##name(V5_DeviceT device);                                      \
+  extern "C" R __wrap_##name(V5_DeviceT device)                                       \
+  {                                                                                   \
+    R value;                                                                          \
+    if (!inputlog::active())                                                          \
+      return __real_##name(device);                                                   \
+    if (inputlog::replayed(kInputFunction_##name, device, 0, &value, sizeof(R)))      \
+      return value;                                                                   \
+    value = __real_##name(device);                                                    \
+    inputlog::recorded(kInputFunction_##name, device, 0, &value, sizeof(R));          \
+    return value;                                                                     \
+  }
+
+#define INPUTLOG_WRAP_ARG(name, R, T)                                                 \
+  extern "C" R __real_##name(V5_DeviceT device, T arg);                               \
+  extern "C" R __wrap_##name(V5_DeviceT device, T arg)                                \
+  {                                                                                   \
+    R value;                                                                          \
+    if (!inputlog::active())                                                          \
+      return __real_##name(device, arg);                                              \
+    if (inputlog::replayed(kInputFunction_##name, device, arg, &value, sizeof(R)))    \
+      return value;                                                                   \
+    value = __real_##name(device, arg);                                               \
+    inputlog::recorded(kInputFunction_##name, device, arg, &value, sizeof(R));        \
+    return value;                                                                     \
+  }
+
+#define INPUTLOG_WRAP_OUT(name, R, T)                                                 \
+  extern "C" void __real_##name(V5_DeviceT device, T *data);                          \
+  extern "C" void __wrap_##name(V5_DeviceT device, T *data)                           \
+  {                                                                                   \
+    if (!inputlog::active() || data == nullptr)                                       \
+      return __real_##name(device, data);                                             \
+    if (inputlog::replayed(kInputFunction_##name, device, 0, data, sizeof(T)))        \
+      return;                                                                         \
+    __real_##name(device, data);                                                      \
+    inputlog::recorded(kInputFunction_##name, device, 0, data, sizeof(T));            \
+  }
+
+// the return value and the output are recorded together
+#define INPUTLOG_WRAP_RETOUT(name, R, T)                                              \
+  extern "C" R __real_##name(V5_DeviceT device, T *data);                             \
+  extern "C" R __wrap_##name(V5_DeviceT device, T *data)                              \
+  {                                                                                   \
+    uint8_t value[sizeof(R) + sizeof(T)];                                             \
+    R r;                                                                              \
+    T t;                                                                              \
+    if (!inputlog::active())                                                          \
+      return __real_##name(device, data);                                             \
+    if (inputlog::replayed(kInputFunction_##name, device, 0, value, sizeof(value)))   \
+    {                                                                                 \
+      memcpy(&r, value, sizeof(R));                                                   \
+      if (data != nullptr)                                                            \
+        memcpy(data, value + sizeof(R), sizeof(T));                                   \
+      return r;                                                                       \
+    }                                                                                 \
+    r = __real_##name(device, &t);                                                    \
+    memcpy(value, &r, sizeof(R));                                                     \
+    memcpy(value + sizeof(R), &t, sizeof(T));                                         \
+    inputlog::recorded(kInputFunction_##name, device, 0, value, sizeof(value));       \
+    if (data != nullptr)                                                              \
+      *data = t;                                                                      \
+    return r;                                                                         \
+  }
+
+#define INPUTLOG_WRAP_ARGOUT(name, R, T)                                              \
+  extern "C" R __real_##name(V5_DeviceT device, uint32_t arg, T *data);               \
+  extern "C" R __wrap_##name(V5_DeviceT device, uint32_t arg, T *data)                \
+  {                                                                                   \
+    uint8_t value[sizeof(R) + sizeof(T)];                                             \
+    R r;                                                                              \
+    if (!inputlog::active() || data == nullptr)                                       \
+      return __real_##name(device, arg, data);                                        \
+    if (inputlog::replayed(kInputFunction_##name, device, arg, value, sizeof(value))) \
+    {                                                                                 \
+      memcpy(&r, value, sizeof(R));                                                   \
+      memcpy(data, value + sizeof(R), sizeof(T));                                     \
+      return r;                                                                       \
+    }                                                                                 \
+    r = __real_##name(device, arg, data);                                             \
+    memcpy(value, &r, sizeof(R));                                                     \
+    memcpy(value + sizeof(R), data, sizeof(T));                                       \
+    inputlog::recorded(kInputFunction_##name, device, arg, value, sizeof(value));     \
+    return r;                                                                         \
+  }
+
+#define INPUTLOG_WRAP_SPECIAL(name, R, T)
+#define INPUTLOG_WRAP(name, kind, R, T) INPUTLOG_WRAP_##kind(name, R, T)
+
+INPUTLOG_FUNCTIONS(INPUTLOG_WRAP)
+
+/*---------------------------------------------------------------------------*/
+/*  Functions that do not fit one of the patterns above                      */
+/*---------------------------------------------------------------------------*/
+
+extern "C" int32_t __real_vexControllerGet(V5_ControllerId id, V5_ControllerIndex index);
+extern "C" int32_t __wrap_vexControllerGet(V5_ControllerId id, V5_ControllerIndex index)
+{
+  int32_t value;
+  if (!inputlog::active())
+    return __real_vexControllerGet(id, index);
+  if (inputlog::replayedPort(kInputFunction_vexControllerGet, id, index, &value, sizeof(value)))
+    return value;
+  value = __real_vexControllerGet(id, index);
+  inputlog::recordedPort(kInputFunction_vexControllerGet, id, index, &value, sizeof(value));
+  return value;
+}
+
+extern "C" int32_t __real_vexDeviceGetStatus(V5_DeviceType *buffer);
+extern "C" int32_t __wrap_vexDeviceGetStatus(V5_DeviceType *buffer)
+{
+  uint8_t value[sizeof(int32_t) + sizeof(V5_DeviceTypeBuffer)];
+  int32_t r;
+  if (!inputlog::active() || buffer == nullptr)
+    return __real_vexDeviceGetStatus(buffer);
+  if (inputlog::replayedPort(kInputFunction_vexDeviceGetStatus, INPUTLOG_NO_PORT, 0, value, sizeof(value)))
+  {
+    memcpy(&r, value, sizeof(r));
+    memcpy(buffer, value + sizeof(r), sizeof(V5_DeviceTypeBuffer));
+    return r;
+  }
+  r = __real_vexDeviceGetStatus(buffer);
+  memcpy(value, &r, sizeof(r));
+  memcpy(value + sizeof(r), buffer, sizeof(V5_DeviceTypeBuffer));
+  inputlog::recordedPort(kInputFunction_vexDeviceGetStatus, INPUTLOG_NO_PORT, 0, value, sizeof(value));
+  return r;
+}
+
+extern "C" int32_t __real_vexDeviceGetTimestampByIndex(int32_t index);
+extern "C" int32_t __wrap_vexDeviceGetTimestampByIndex(int32_t index)
+{
+  int32_t value;
+  if (!inputlog::active())
+    return __real_vexDeviceGetTimestampByIndex(index);
+  if (inputlog::replayedPort(kInputFunction_vexDeviceGetTimestampByIndex, index, 0, &value, sizeof(value)))
+    return value;
+  value = __real_vexDeviceGetTimestampByIndex(index);
+  inputlog::recordedPort(kInputFunction_vexDeviceGetTimestampByIndex, index, 0, &value, sizeof(value));
+  return value;
+}
+
+extern "C" uint32_t __real_vexDeviceButtonStateGet(void);
+extern "C" uint32_t __wrap_vexDeviceButtonStateGet(void)
+{
+  uint32_t value;
+  if (!inputlog::active())
+    return __real_vexDeviceButtonStateGet();
+  if (inputlog::replayedPort(kInputFunction_vexDeviceButtonStateGet, INPUTLOG_NO_PORT, 0, &value, sizeof(value)))
+    return value;
+  value = __real_vexDeviceButtonStateGet();
+  inputlog::recordedPort(kInputFunction_vexDeviceButtonStateGet, INPUTLOG_NO_PORT, 0, &value, sizeof(value));
+  return value;
+}
+
+extern "C" uint32_t __real_vexDevicesGetNumber(void);
+extern "C" uint32_t __wrap_vexDevicesGetNumber(void)
+{
+  uint32_t value;
+  if (!inputlog::active())
+    return __real_vexDevicesGetNumber();
+  if (inputlog::replayedPort(kInputFunction_vexDevicesGetNumber, INPUTLOG_NO_PORT, 0, &value, sizeof(value)))
+    return value;
+  value = __real_vexDevicesGetNumber();
+  inputlog::recordedPort(kInputFunction_vexDevicesGetNumber, INPUTLOG_NO_PORT, 0, &value, sizeof(value));
+  return value;
+}
+
+extern "C" uint32_t __real_vexDevicesGetNumberByType(V5_DeviceType type);
+extern "C" uint32_t __wrap_vexDevicesGetNumberByType(V5_DeviceType type)
+{
+  uint32_t value;
+  if (!inputlog::active())
+    return __real_vexDevicesGetNumberByType(type);
+  if (inputlog::replayedPort(kInputFunction_vexDevicesGetNumberByType, INPUTLOG_NO_PORT, type, &value, sizeof(value)))
+    return value;
+  value = __real_vexDevicesGetNumberByType(type);
+  inputlog::recordedPort(kInputFunction_vexDevicesGetNumberByType, INPUTLOG_NO_PORT, type, &value, sizeof(value));
+  return value;
+}
+
+extern "C" void __real_vexDeviceGpsAttitudeGet(V5_DeviceT device, V5_DeviceGpsAttitude *data, bool bRaw);
+extern "C" void __wrap_vexDeviceGpsAttitudeGet(V5_DeviceT device, V5_DeviceGpsAttitude *data, bool bRaw)
+{
+  if (!inputlog::active() || data == nullptr)
+    return __real_vexDeviceGpsAttitudeGet(device, data, bRaw);
+  if (inputlog::replayed(kInputFunction_vexDeviceGpsAttitudeGet, device, bRaw, data, sizeof(*data)))
+    return;
+  __real_vexDeviceGpsAttitudeGet(device, data, bRaw);
+  inputlog::recorded(kInputFunction_vexDeviceGpsAttitudeGet, device, bRaw, data, sizeof(*data));
+}
+
+extern "C" void __real_vexDeviceGpsOriginGet(V5_DeviceT device, double *ox, double *oy);
+extern "C" void __wrap_vexDeviceGpsOriginGet(V5_DeviceT device, double *ox, double *oy)
+{
+  double value[2];
+  if (!inputlog::active() || ox == nullptr || oy == nullptr)
+    return __real_vexDeviceGpsOriginGet(device, ox, oy);
+  if (!inputlog::replayed(kInputFunction_vexDeviceGpsOriginGet, device, 0, value, sizeof(value)))
+  {
+    __real_vexDeviceGpsOriginGet(device, &value[0], &value[1]);
+    inputlog::recorded(kInputFunction_vexDeviceGpsOriginGet, device, 0, value, sizeof(value));
+  }
+  *ox = value[0];
+  *oy = value[1];
+}
+
+extern "C" uint32_t __real_vexDevicePneumaticActuationStatusGet(V5_DeviceT device, uint16_t *ac1, uint16_t *ac2, uint16_t *ac3, uint16_t *ac4);
+extern "C" uint32_t __wrap_vexDevicePneumaticActuationStatusGet(V5_DeviceT device, uint16_t *ac1, uint16_t *ac2, uint16_t *ac3, uint16_t *ac4)
+{
+  // the return value followed by the four counts
+  uint16_t value[6];
+  uint32_t r;
+  if (!inputlog::active() || ac1 == nullptr || ac2 == nullptr || ac3 == nullptr || ac4 == nullptr)
+    return __real_vexDevicePneumaticActuationStatusGet(device, ac1, ac2, ac3, ac4);
+  if (!inputlog::replayed(kInputFunction_vexDevicePneumaticActuationStatusGet, device, 0, value, sizeof(value)))
+  {
+    r = __real_vexDevicePneumaticActuationStatusGet(device, &value[2], &value[3], &value[4], &value[5]);
+    memcpy(value, &r, sizeof(r));
+    inputlog::recorded(kInputFunction_vexDevicePneumaticActuationStatusGet, device, 0, value, sizeof(value));
+  }
+  memcpy(&r, value, sizeof(r));
+  *ac1 = value[2];
+  *ac2 = value[3];
+  *ac3 = value[4];
+  *ac4 = value[5];
+  return r;
+}
+
+extern "C" void __real_vexDeviceArmTipPositionGet(V5_DeviceT device, int32_t *x, int32_t *y, int32_t *z);
+extern "C" void __wrap_vexDeviceArmTipPositionGet(V5_DeviceT device, int32_t *x, int32_t *y, int32_t *z)
+{
+  int32_t value[3];
+  if (!inputlog::active() || x == nullptr || y == nullptr || z == nullptr)
+    return __real_vexDeviceArmTipPositionGet(device, x, y, z);
+  if (!inputlog::replayed(kInputFunction_vexDeviceArmTipPositionGet, device, 0, value, sizeof(value)))
+  {
+    __real_vexDeviceArmTipPositionGet(device, &value[0], &value[1], &value[2]);
+    inputlog::recorded(kInputFunction_vexDeviceArmTipPositionGet, device, 0, value, sizeof(value));
+  }
+  *x = value[0];
+  *y = value[1];
+  *z = value[2];
+}
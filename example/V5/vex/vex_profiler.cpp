@@ -0,0 +1,198 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_profiler.cpp                                            */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_profiler.cpp
+ * @brief   Interrupt sampling for the PROFILER=1 build
+ * @details
+ *  Only linked when building with PROFILER=1.  vexProfilerInstall points
+ *  VBAR at a copy of the exception vectors whose entries jump to the
+ *  original ones, except IRQ, which goes through vexProfilerIrq first.
+ *  That reads the pending interrupt from the GIC without acknowledging it
+ *  and, for every interval'th system tick, stores the interrupted address
+ *  in a ring, then continues at the original IRQ vector with every
+ *  register as it was.  The tick rate and its handler are not touched, the
+ *  runtime's timers run as before.  Samples are taken out of the ring by
+ *  vex::profiler with vexProfilerRead.
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <cstddef>
+
+#include "v5_cpp.h"
+
+#define PROFILER_RING 1024 // samples, a power of two
+#define PROFILER_RING_BITS 10
+#define PROFILER_TICK_IRQ 29 // Cortex-A9 private timer
+
+#define PROFILER_STR2(x) #x
+#define PROFILER_STR(x) PROFILER_STR2(x)
+
+// the offsets are used by vexProfilerIrq
+struct _profilerState
+{
+  volatile uint32_t countdown; // ticks to the next sample
+  volatile uint32_t interval;
+  volatile uint32_t head; // only changed by vexProfilerIrq
+  volatile uint32_t tail; // only changed by vexProfilerRead
+  volatile uint32_t dropped;
+  volatile uint32_t forward; // the original IRQ vector
+  uint32_t samples[PROFILER_RING];
+};
+
+static_assert(offsetof(_profilerState, forward) == 20 && offsetof(_profilerState, samples) == 24,
+              "vexProfilerIrq uses these offsets");
+
+extern "C"
+{
+  _profilerState vexProfilerState;
+  void vexProfilerIrq(void);
+}
+
+// ldr pc, [pc, #24], jumps to the address 8 words on
+#define PROFILER_LDR_PC 0xE59FF018
+
+static uint32_t _vectors[16] __attribute__((aligned(32)));
+static uint32_t _vbar;
+static bool _installed = false;
+
+// runs in IRQ mode in place of the IRQ vector, so it is ARM code and only
+// uses its own stack slots, the original vector sees the same registers
+extern "C" __attribute__((naked, target("arm"))) void
+vexProfilerIrq(void)
+{
+  asm volatile(
+      "sub    sp, sp, #4\n"
+      "push   {r0-r3}\n"
+      // GIC CPU interface highest pending interrupt, reading does not acknowledge it
+      "movw   r0, #0x0118\n"
+      "movt   r0, #0xF8F0\n"
+      "ldr    r0, [r0]\n"
+      "ubfx   r0, r0, #0, #10\n"
+      "cmp    r0, #" PROFILER_STR(PROFILER_TICK_IRQ) "\n"
+      "movw   r0, #:lower16:vexProfilerState\n"
+      "movt   r0, #:upper16:vexProfilerState\n"
+      "bne    2f\n"
+      "ldr    r1, [r0, #0]\n"
+      "subs   r1, r1, #1\n"
+      "ldrle  r1, [r0, #4]\n"
+      "str    r1, [r0, #0]\n"
+      "bgt    2f\n"
+      "ldr    r1, [r0, #8]\n"
+      "ldr    r2, [r0, #12]\n"
+      "sub    r2, r1, r2\n"
+      "cmp    r2, #" PROFILER_STR(PROFILER_RING) "\n"
+      "bhs    1f\n"
+      "ubfx   r2, r1, #0, #" PROFILER_STR(PROFILER_RING_BITS) "\n"
+      "add    r2, r0, r2, lsl #2\n"
+      "sub    r3, lr, #4\n"
+      "str    r3, [r2, #24]\n"
+      "add    r1, r1, #1\n"
+      "str    r1, [r0, #8]\n"
+      "b      2f\n"
+      "1:\n"
+      "ldr    r1, [r0, #16]\n"
+      "add    r1, r1, #1\n"
+      "str    r1, [r0, #16]\n"
+      "2:\n"
+      "ldr    r1, [r0, #20]\n"
+      "str    r1, [sp, #16]\n"
+      "pop    {r0-r3, pc}\n");
+}
+
+static uint32_t
+_readVbar()
+{
+  uint32_t v;
+  asm volatile("mrc p15, 0, %0, c12, c0, 0" : "=r"(v));
+  return v;
+}
+
+static void
+_writeVbar(uint32_t v)
+{
+  asm volatile("mcr p15, 0, %0, c12, c0, 0\n"
+               "isb" ::"r"(v)
+               : "memory");
+}
+
+extern "C" bool
+vexProfilerInstall(uint32_t interval)
+{
+  if (_installed)
+    return false;
+  // with SCTLR.V set the vectors are at 0xFFFF0000 and VBAR is not used,
+  // with SCTLR.TE set exceptions are taken in Thumb state and the copied
+  // vectors are ARM code
+  uint32_t sctlr;
+  asm volatile("mrc p15, 0, %0, c1, c0, 0" : "=r"(sctlr));
+  if (sctlr & ((1u << 13) | (1u << 30)))
+    return false;
+
+  _profilerState &s = vexProfilerState;
+  s.interval = interval;
+  s.countdown = interval;
+  s.head = 0;
+  s.tail = 0;
+  s.dropped = 0;
+
+  _vbar = _readVbar();
+  s.forward = _vbar + 0x18;
+  for (uint32_t i = 0; i < 8; i++)
+  {
+    _vectors[i] = PROFILER_LDR_PC;
+    _vectors[8 + i] = _vbar + i * 4;
+  }
+  _vectors[8 + 6] = (uint32_t)&vexProfilerIrq;
+
+  // the table is fetched as instructions
+  for (uint32_t a = (uint32_t)_vectors; a < (uint32_t)(_vectors + 16); a += 32)
+    asm volatile("mcr p15, 0, %0, c7, c11, 1" ::"r"(a) : "memory");
+  asm volatile("dsb\n"
+               "mcr p15, 0, %0, c7, c5, 0\n"
+               "mcr p15, 0, %0, c7, c5, 6\n"
+               "dsb\n"
+               "isb" ::"r"(0)
+               : "memory");
+
+  _writeVbar((uint32_t)_vectors);
+  _installed = true;
+  return true;
+}
+
+extern "C" void
+vexProfilerRemove(void)
+{
+  if (!_installed)
+    return;
+  _writeVbar(_vbar);
+  _installed = false;
+}
+
+extern "C" uint32_t
+vexProfilerRead(uint32_t *samples, uint32_t max)
+{
+  _profilerState &s = vexProfilerState;
+  uint32_t n = 0;
+  uint32_t head = s.head;
+  while (s.tail != head && n < max)
+  {
+    samples[n++] = s.samples[s.tail % PROFILER_RING];
+    s.tail = s.tail + 1;
+  }
+  return n;
+}
+
+extern "C" uint32_t
+vexProfilerDropped(void)
+{
+  return vexProfilerState.dropped;
+}
@@ -0,0 +1,72 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_slimrt.cpp                                              */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_slimrt.cpp
+ * @brief   Runtime support for the slim (SLIM=1) build profile
+ * @details
+ *  Only linked when building with SLIM=1.  The standard library throws from
+ *  operator new and from the std::__throw_* helpers in functexcept.o, both of
+ *  which drag the whole unwinder into the image.  Defining the complete set
+ *  here keeps those archive members out, a failure just stops the program.
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <cstdlib>
+#include <new>
+
+#include "v5_api.h"
+
+[[noreturn]] static void
+_slimFatal(const char *msg)
+{
+  vex_printf("fatal: %s\n", msg);
+  vexSystemExitRequest();
+  for (;;)
+    vexBackgroundProcessing();
+}
+
+void *operator new(std::size_t size)
+{
+  void *p = malloc(size ? size : 1);
+  if (p == nullptr)
+    _slimFatal("out of memory");
+  return p;
+}
+
+void *operator new[](std::size_t size)
+{
+  return ::operator new(size);
+}
+
+namespace std
+{
+  void __throw_bad_exception() { _slimFatal("bad_exception"); }
+  void __throw_bad_alloc() { _slimFatal("bad_alloc"); }
+  void __throw_bad_array_new_length() { _slimFatal("bad_array_new_length"); }
+  void __throw_bad_cast() { _slimFatal("bad_cast"); }
+  void __throw_bad_typeid() { _slimFatal("bad_typeid"); }
+  void __throw_bad_function_call() { _slimFatal("bad_function_call"); }
+  void __throw_logic_error(const char *s) { _slimFatal(s); }
+  void __throw_domain_error(const char *s) { _slimFatal(s); }
+  void __throw_invalid_argument(const char *s) { _slimFatal(s); }
+  void __throw_length_error(const char *s) { _slimFatal(s); }
+  void __throw_out_of_range(const char *s) { _slimFatal(s); }
+  void __throw_out_of_range_fmt(const char *s, ...) { _slimFatal(s); }
+  void __throw_runtime_error(const char *s) { _slimFatal(s); }
+  void __throw_range_error(const char *s) { _slimFatal(s); }
+  void __throw_overflow_error(const char *s) { _slimFatal(s); }
+  void __throw_underflow_error(const char *s) { _slimFatal(s); }
+  void __throw_ios_failure(const char *s) { _slimFatal(s); }
+  void __throw_ios_failure(const char *s, int) { _slimFatal(s); }
+  void __throw_system_error(int) { _slimFatal("system_error"); }
+  void __throw_future_error(int) { _slimFatal("future_error"); }
+}
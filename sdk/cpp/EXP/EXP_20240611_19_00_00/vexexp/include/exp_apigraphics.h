@@ -24,6 +24,12 @@
 extern "C" {
 #endif
 
+// maximum buffer size and row length, in pixels
+// pixels are RGB565, every row is EXP_OFFSCREEN_STRIDE pixels long
+#define EXP_OFFSCREEN_MAX_WIDTH     160
+#define EXP_OFFSCREEN_MAX_HEIGHT    160
+#define EXP_OFFSCREEN_STRIDE        160
+
 // Some offscreen user side drawing functions
 typedef struct {
     uint16_t  *pBuf;
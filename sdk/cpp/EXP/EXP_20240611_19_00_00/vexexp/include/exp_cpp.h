@@ -1,4 +1,5 @@
 #include "exp_api.h"
+#include "exp_apigraphics.h"
 
 #if defined(__has_include)
 #if __has_include("exp_apiprivate.h")
@@ -24,6 +25,7 @@
 #include "vex_gps.h"
 #include "vex_controller.h"
 #include "vex_brain.h"
+#include "vex_canvas.h"
 #include "vex_competition.h"
 #include "vex_triport.h"
 #include "vex_timer.h"
@@ -0,0 +1,214 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_canvas.h                                                */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_CANVAS_CLASS_H
+#define   VEX_CANVAS_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_canvas.h
+  * @brief   Offscreen canvas class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+    /**
+      * @brief Use the canvas class to draw into memory and copy the result to the screen.
+      * @details
+      *  A canvas wraps a vexOffscreenBuffer.  Static parts of a user interface can
+      *  be drawn into a canvas once and then copied to the screen with blit()
+      *  whenever they are needed, which is much cheaper than drawing them again.
+      *  Colors are passed as 0x00RRGGBB and stored as 16 bit pixels in the
+      *  runtime's format, rows are stride() pixels apart.
+      *  Drawing outside the canvas is clipped.
+    */
+    class brain::lcd::canvas {
+        private:
+          vexOffscreenBuffer *_osb;
+
+          // byte swapped RGB565, the format the runtime stores
+          static uint16_t _pixel( uint32_t rgb ) {
+            return ((rgb & 0xF80000) >> 16) | ((rgb >> 13) & 0x07) |
+                   ((rgb & 0x001C00) <<  3) | ((rgb & 0x0000F8) << 5);
+          }
+
+          // fills an area already clipped to the canvas
+          void _fill( int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t pixel ) {
+            for( int32_t row = y1; row <= y2; row++ ) {
+              uint16_t *p = _osb->pBuf + row * stride();
+              for( int32_t col = x1; col <= x2; col++ )
+                p[col] = pixel;
+            }
+          }
+
+        public:
+         /**
+          * @brief Creates a new canvas.
+          * @param width The width of the canvas in pixels, at most EXP_OFFSCREEN_MAX_WIDTH.
+          * @param height The height of the canvas in pixels, at most EXP_OFFSCREEN_MAX_HEIGHT.
+          * @param background The color the canvas is cleared to.
+         */
+          canvas( int32_t width, int32_t height, uint32_t background = 0x000000 ) {
+            _osb = nullptr;
+            if( width > 0 && height > 0 )
+              _osb = vexDisplayOffscreenBufferGet( width, height, background );
+          }
+          ~canvas() {
+            if( _osb != nullptr )
+              vexDisplayOffscreenBufferDestroy( _osb );
+          }
+
+          canvas( const canvas & ) = delete;
+          canvas & operator=( const canvas & ) = delete;
+
+         /**
+          * @brief Checks if the canvas memory was allocated.
+          * @return Returns true if the canvas can be used.
+          */
+          bool      valid() const { return _osb != nullptr && _osb->pBuf != nullptr; }
+
+          int32_t   width() const  { return valid() ? _osb->width  : 0; }
+          int32_t   height() const { return valid() ? _osb->height : 0; }
+          static constexpr int32_t stride() { return EXP_OFFSCREEN_STRIDE; }
+
+         /**
+          * @brief Gets the pixel memory, row y starts at data() + y * stride().
+          * @return Returns a pointer to the first pixel or nullptr if the canvas is not valid.
+          */
+          uint16_t *data() { return valid() ? _osb->pBuf : nullptr; }
+          const uint16_t *data() const { return valid() ? _osb->pBuf : nullptr; }
+
+         /**
+          * @brief Gets the underlying offscreen buffer for use with the vexDisplayOffscreenBuffer functions.
+          */
+          vexOffscreenBuffer *buffer() { return _osb; }
+
+         /**
+          * @brief Clears the canvas to the background color.
+          */
+          void      clear() {
+            if( valid() )
+              clear( _osb->bgColor );
+          }
+
+         /**
+          * @brief Clears the canvas to a color.
+          * @param rgb The color to fill the canvas with.
+          */
+          void      clear( uint32_t rgb ) {
+            drawRectangle( 0, 0, width(), height(), rgb, true );
+          }
+
+         /**
+          * @brief Sets the color of a single pixel.
+          * @param x The x-coordinate of the pixel.
+          * @param y The y-coordinate of the pixel.
+          * @param rgb The new color.
+          */
+          void      drawPixel( int32_t x, int32_t y, uint32_t rgb ) {
+            vexDisplayOffscreenBufferPixelSet( _osb, x, y, rgb );
+          }
+
+         /**
+          * @brief Gets the color of a single pixel.
+          * @return Returns the pixel color, or 0 if the coordinates are outside the canvas.
+          * @param x The x-coordinate of the pixel.
+          * @param y The y-coordinate of the pixel.
+          */
+          uint32_t  getPixel( int32_t x, int32_t y ) const {
+            return vexDisplayOffscreenBufferPixelGet( _osb, x, y );
+          }
+
+         /**
+          * @brief Draws a rectangle.
+          * @param x The x-coordinate of the top left corner.
+          * @param y The y-coordinate of the top left corner.
+          * @param width The width of the rectangle.
+          * @param height The height of the rectangle.
+          * @param rgb The color of the rectangle.
+          * @param fill If true the rectangle is filled, otherwise only the outline is drawn.
+          */
+          void      drawRectangle( int32_t x, int32_t y, int32_t width, int32_t height, uint32_t rgb, bool fill = false ) {
+            if( !valid() || width <= 0 || height <= 0 )
+              return;
+
+            // clip here, the runtime tests every pixel
+            int32_t x1 = x < 0 ? 0 : x;
+            int32_t y1 = y < 0 ? 0 : y;
+            int32_t x2 = x + width  - 1 < this->width()  - 1 ? x + width  - 1 : this->width()  - 1;
+            int32_t y2 = y + height - 1 < this->height() - 1 ? y + height - 1 : this->height() - 1;
+            if( x2 < x1 || y2 < y1 )
+              return;
+
+            uint16_t pixel = _pixel( rgb );
+            if( fill ) {
+              _fill( x1, y1, x2, y2, pixel );
+              return;
+            }
+
+            // the edges that are inside the canvas, RectDraw would convert the color twice
+            if( y == y1 )
+              _fill( x1, y1, x2, y1, pixel );
+            if( y + height - 1 == y2 )
+              _fill( x1, y2, x2, y2, pixel );
+            if( x == x1 )
+              _fill( x1, y1, x1, y2, pixel );
+            if( x + width - 1 == x2 )
+              _fill( x2, y1, x2, y2, pixel );
+          }
+
+         /**
+          * @brief Scrolls the canvas contents left, the uncovered columns are set to the background color.
+          * @param pixels The number of pixels to scroll by.
+          */
+          void      scroll( int32_t pixels ) {
+            if( !valid() || pixels <= 0 || pixels >= stride() )
+              return;
+            vexDisplayOffscreenBufferScrollH( _osb, pixels );
+
+            // the runtime fills them with bgColor unconverted
+            int32_t x1 = width() - pixels < 0 ? 0 : width() - pixels;
+            _fill( x1, 0, width() - 1, height() - 1, _pixel( _osb->bgColor ) );
+          }
+
+         /**
+          * @brief Copies the whole canvas to the screen.
+          * @param x The screen x-coordinate of the left edge.
+          * @param y The screen y-coordinate of the top edge.
+          */
+          void      blit( int32_t x, int32_t y ) {
+            blit( x, y, 0, 0, width(), height() );
+          }
+
+         /**
+          * @brief Copies part of the canvas to the screen.
+          * @param x The screen x-coordinate of the left edge.
+          * @param y The screen y-coordinate of the top edge.
+          * @param sx The canvas x-coordinate of the area to copy.
+          * @param sy The canvas y-coordinate of the area to copy.
+          * @param width The width of the area to copy.
+          * @param height The height of the area to copy.
+          */
+          void      blit( int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t width, int32_t height ) {
+            if( !valid() || sx < 0 || sy < 0 || width <= 0 || height <= 0 )
+              return;
+            if( sx + width > this->width() )
+              width = this->width() - sx;
+            if( sy + height > this->height() )
+              height = this->height() - sy;
+            if( width <= 0 || height <= 0 )
+              return;
+
+            // the runtime reads 16 bit pixels through the uint32_t pointer
+            vexDisplayCopyRect( x, y, x + width - 1, y + height - 1, (uint32_t *)(_osb->pBuf + sy * stride() + sx), stride() );
+          }
+    };
+};
+
+#endif // VEX_CANVAS_CLASS_H
@@ -14,6 +14,7 @@
 
 #include "v5_api.h"
 #include "v5_apiprivate.h"
+#include "v5_layout.h"
 
 #ifdef V5_VEX_INCLUDE_OFFSCREEN_BUFFER
 #include "v5_apigraphics.h"
@@ -0,0 +1,58 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     v5_apigraphics.h                                            */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:  V0.1                                                        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef V5_APIGRAPHICS_H_
+#define V5_APIGRAPHICS_H_
+
+#include "stdint.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    v5_apigraphics.h
+ * @brief   Header for V5 offscreen graphics
+ * @details
+ *  The functions are part of libv5rt, this header declares them with the same
+ *  names as the EXP runtime.  On V5 each pixel is a 32 bit 0x00RRGGBB value
+ *  and every row is V5_OFFSCREEN_STRIDE pixels long whatever the buffer width,
+ *  so the buffer can be passed straight to vexDisplayCopyRect.
+ */
+/*---------------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// maximum buffer size and row length, in pixels
+#define V5_OFFSCREEN_MAX_WIDTH 512
+#define V5_OFFSCREEN_MAX_HEIGHT 512
+#define V5_OFFSCREEN_STRIDE 512
+
+  // Some offscreen user side drawing functions
+  typedef struct
+  {
+    uint32_t *pBuf;
+    uint32_t width;
+    uint32_t height;
+    uint32_t bgColor;
+  } vexOffscreenBuffer;
+
+  vexOffscreenBuffer *vexDisplayOffscreenBufferGet(uint32_t width, int32_t height, uint32_t color);
+  void vexDisplayOffscreenBufferDestroy(vexOffscreenBuffer *pOsb);
+  void vexDisplayOffscreenBufferPixelSet(vexOffscreenBuffer *pOsb, uint32_t x, uint32_t y, uint32_t color);
+  uint32_t vexDisplayOffscreenBufferPixelGet(vexOffscreenBuffer *pOsb, uint32_t x, uint32_t y);
+  void vexDisplayOffscreenBufferRectDraw(vexOffscreenBuffer *pOsb, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+  void vexDisplayOffscreenBufferRectFill(vexOffscreenBuffer *pOsb, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+  void vexDisplayOffscreenBufferScrollH(vexOffscreenBuffer *pOsb, uint32_t pix);
+  void vexDisplayOffscreenBufferBlit(vexOffscreenBuffer *pOsb, uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* V5_APIGRAPHICS_H_ */
@@ -1,5 +1,7 @@
 #include "v5_api.h"
 #include "v5_apiprivate.h"
+#include "v5_layout.h"
+#include "v5_apigraphics.h"
 
 #include "vex_task.h"
 #include "vex_thread.h"
@@ -9,6 +11,7 @@
 #include "vex_units.h"
 #include "vex_color.h"
 #include "vex_device.h"
+#include "vex_devicestate.h"
 #include "vex_motor.h"
 #include "vex_vision.h"
 #include "vex_imu.h"
@@ -19,6 +22,34 @@
 #include "vex_gps.h"
 #include "vex_controller.h"
 #include "vex_brain.h"
+#include "vex_pixel.h"
+#include "vex_spriteformat.h"
+#include "vex_crc.h"
+#include "vex_captureformat.h"
+#include "vex_varint.h"
+#include "vex_telemetryformat.h"
+#include "vex_lzformat.h"
+#include "vex_inputlogformat.h"
+#include "vex_traceformat.h"
+#include "vex_profileformat.h"
+#include "vex_screen.h"
+#include "vex_canvas.h"
+#include "vex_imagecache.h"
+#include "vex_sprite.h"
+#include "vex_screencapture.h"
+#include "vex_sdlogger.h"
+#include "vex_telemetry.h"
+#include "vex_configstore.h"
+#include "vex_fileindex.h"
+#include "vex_filereader.h"
+#include "vex_inputlog.h"
+#include "vex_trace.h"
+#include "vex_profiler.h"
+#include "vex_metrics.h"
+#include "vex_textcache.h"
+#include "vex_plot.h"
+#include "vex_framegovernor.h"
+#include "vex_touchui.h"
 #include "vex_competition.h"
 #include "vex_triport.h"
 #include "vex_timer.h"
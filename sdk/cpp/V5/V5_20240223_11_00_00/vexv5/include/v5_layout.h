@@ -0,0 +1,40 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     v5_layout.h                                                 */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:  V0.1                                                        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef V5_LAYOUT_H_
+#define V5_LAYOUT_H_
+
+/*-----------------------------------------------------------------------------*/
+/** @file    v5_layout.h
+ * @brief   Code placement attributes used with the V5 linker script
+ * @details
+ *  lscript.ld places .text in this order after the vectors
+ *    cold, exit and startup code
+ *    hot code tagged with vex_hot
+ *    code listed in ORDER_FILE (see mkenv.mk), in file order
+ *    everything else
+ *  so the functions a control loop runs every cycle share as few cache lines
+ *  as possible.  __text_hot_start and __text_hot_end bound the hot region.
+ */
+/*---------------------------------------------------------------------------*/
+
+// function runs every control cycle, group it with other hot code
+// the compiler names its section .text.hot.<name>, so unused hot functions
+// are still removed by --gc-sections
+#define vex_hot __attribute__((hot))
+
+// function runs rarely, eg. error handling or configuration
+// placed in .text.unlikely.<name> by the compiler
+#define vex_cold __attribute__((cold))
+
+// function only runs during program startup
+#define vex_startup __attribute__((cold, section(".text.startup")))
+
+#endif /* V5_LAYOUT_H_ */
@@ -195,6 +195,52 @@ namespace vex
       const vex::color &color;
     };
 
+    /**
+     * @brief A compact, trivially copyable copy of an object that can be memcpy'd into queues and history buffers.
+     * @details The class name is not copied, look it up from the id when needed.
+     */
+    class record
+    {
+      float _angle = 0;
+      uint32_t _rgb = 0;
+      int16_t _id = 0;
+      uint8_t _type = 0;
+      bool _exists = false;
+      int16_t _originX = 0;
+      int16_t _originY = 0;
+      int16_t _centerX = 0;
+      int16_t _centerY = 0;
+      int16_t _width = 0;
+      int16_t _height = 0;
+      object::tagcoords _tag = {};
+
+    public:
+      record() = default;
+
+      /**
+       * @brief Creates a new record holding the properties of an object.
+       * @param obj The object whose properties are to be copied.
+       */
+      record(const object &obj) : _angle(obj.angle), _rgb(obj.color.rgb()), _id((int16_t)obj.id),
+                                  _type((uint8_t)obj.type), _exists(obj.exists),
+                                  _originX(obj.originX), _originY(obj.originY),
+                                  _centerX(obj.centerX), _centerY(obj.centerY),
+                                  _width(obj.width), _height(obj.height), _tag(obj.tag) {}
+
+      int32_t id() const { return _id; }
+      objectType type() const { return (objectType)_type; }
+      int32_t originX() const { return _originX; }
+      int32_t originY() const { return _originY; }
+      int32_t centerX() const { return _centerX; }
+      int32_t centerY() const { return _centerY; }
+      int32_t width() const { return _width; }
+      int32_t height() const { return _height; }
+      double angle() const { return _angle; }
+      bool exists() const { return _exists; }
+      const object::tagcoords &tag() const { return _tag; }
+      uint32_t rgb() const { return _rgb; }
+    };
+
     class objdesc
     {
     protected:
@@ -358,6 +404,34 @@ namespace vex
      */
     safearray<object, AIVISION_MAX_OBJECTS> objects;
 
+    /**
+     * @brief The objects found in the last data sample, accessed without bounds checks.
+     * @return Returns a span over the first objectCount entries of objects.
+     */
+    std::span<object> detected()
+    {
+      int32_t n = objectCount < 0 ? 0 : (objectCount > AIVISION_MAX_OBJECTS ? AIVISION_MAX_OBJECTS : objectCount);
+      return objects.span().first(n);
+    }
+
+    /**
+     * @brief Copies the objects found in the last data sample into compact records.
+     * @return Returns the number of records written.
+     * @param buffer Pointer to an array of records.
+     * @param len The number of records the buffer can hold.
+     */
+    int32_t getRecords(record *buffer, int32_t len)
+    {
+      int32_t n = 0;
+      for (object &obj : detected())
+      {
+        if (n >= len)
+          break;
+        buffer[n++] = record(obj);
+      }
+      return n;
+    }
+
   protected:
     void enableTest(uint8_t value);
 
@@ -396,4 +470,6 @@ namespace vex
   };
 };
 
+static_assert(std::is_trivially_copyable<vex::aivision::record>::value, "aivision::record must stay trivially copyable");
+
 #endif // VEX_AIVISION_CLASS_H
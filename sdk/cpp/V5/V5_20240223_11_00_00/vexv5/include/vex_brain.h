@@ -552,6 +552,11 @@ namespace vex
        */
       bool drawImageFromFile(const char *name, int x, int y);
 
+      /**
+       * @brief An offscreen pixel buffer that is drawn once and copied to the screen, see vex_canvas.h.
+       */
+      class canvas;
+
       // not for public use yet
       void waitForRefresh();
       void renderDisable();
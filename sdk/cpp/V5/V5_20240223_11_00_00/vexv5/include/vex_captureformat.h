@@ -0,0 +1,294 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_captureformat.h                                         */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_CAPTUREFORMAT_H
+#define VEX_CAPTUREFORMAT_H
+
+#include <stdint.h>
+
+#include "vex_crc.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_captureformat.h
+ * @brief   Streaming PNG, BMP and raw encoder for screen captures
+ * @details
+ *  captureformat::encoder turns 32 bit 0x00RRGGBB pixels into a file a few
+ *  bytes at a time, so a capture can be written in small chunks without
+ *  holding the encoded file in memory.
+ *
+ *    PNG  24 bit, deflate stored blocks, no compression and no zlib
+ *    BMP  24 bit, top down rows
+ *    raw  the pixels as little endian uint32_t, width * 4 bytes per row
+ *
+ *  The encoded size is known before encoding starts.  tools/host/fbdump.cpp
+ *  uses it to convert raw captures and host framebuffer dumps.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace captureformat
+  {
+#define CAPTURE_MAX_WIDTH 512
+
+    enum class tCaptureFormat
+    {
+      kCaptureFormatPng = 0,
+      kCaptureFormatBmp,
+      kCaptureFormatRaw
+    };
+
+    /**
+     * @brief Encodes pixels into a PNG, BMP or raw file in pieces.
+     */
+    class encoder
+    {
+    public:
+      /**
+       * @brief Creates a new encoder.
+       * @param pixels Pointer to the top left pixel, it must stay valid until encoding is done.
+       * @param width The width in pixels, at most CAPTURE_MAX_WIDTH.
+       * @param height The height in pixels.
+       * @param stride The number of pixels between rows.
+       * @param format The file format.
+       */
+      encoder(const uint32_t *pixels, int32_t width, int32_t height, int32_t stride, tCaptureFormat format)
+          : _pixels(pixels), _width(width), _height(height), _stride(stride), _format(format)
+      {
+        if (_pixels == nullptr || _width <= 0 || _width > CAPTURE_MAX_WIDTH || _height <= 0)
+          _width = _height = 0;
+        _row = -1;
+        _len = 0;
+        _pos = 0;
+        _adler = 1;
+      }
+      ~encoder() {};
+
+      bool valid() const { return _width > 0; }
+
+      /**
+       * @brief Gets the size of the encoded file.
+       * @return Returns the number of bytes next() will produce in total.
+       */
+      uint32_t size() const
+      {
+        if (!valid())
+          return 0;
+        if (_format == tCaptureFormat::kCaptureFormatPng)
+          return 8 + 25 + _height * (12 + 5 + 1 + 3 * _width) + 2 + 4 + 12;
+        if (_format == tCaptureFormat::kCaptureFormatBmp)
+          return 54 + _height * _bmpStride();
+        return _height * _width * 4;
+      }
+
+      /**
+       * @brief Encodes the next part of the file.
+       * @return Returns the number of bytes written to buf, 0 when the file is complete.
+       * @param buf The output.
+       * @param len The size of buf in bytes.
+       */
+      uint32_t next(uint8_t *buf, uint32_t len)
+      {
+        uint32_t n = 0;
+        while (n < len)
+        {
+          if (_pos == _len && !_fill())
+            break;
+          uint32_t count = _len - _pos < len - n ? _len - _pos : len - n;
+          for (uint32_t i = 0; i < count; i++)
+            buf[n + i] = _piece[_pos + i];
+          _pos += count;
+          n += count;
+        }
+        return n;
+      }
+
+      /**
+       * @brief Checks if the whole file has been produced.
+       * @return Returns true once next() has nothing more to give.
+       */
+      bool done() const { return !valid() || (_row > _height && _pos == _len); }
+
+    private:
+      const uint32_t *_pixels;
+      int32_t _width;
+      int32_t _height;
+      int32_t _stride;
+      tCaptureFormat _format;
+      int32_t _row; // -1 is the file header, _height the trailer
+      uint32_t _len;
+      uint32_t _pos;
+      uint32_t _adler;
+      uint8_t _piece[64 + 4 * CAPTURE_MAX_WIDTH];
+
+      uint32_t _bmpStride() const { return (3 * _width + 3) & ~3u; }
+
+      static void _be32(uint8_t *p, uint32_t v)
+      {
+        p[0] = v >> 24;
+        p[1] = v >> 16;
+        p[2] = v >> 8;
+        p[3] = v;
+      }
+
+      static void _le32(uint8_t *p, uint32_t v)
+      {
+        p[0] = v;
+        p[1] = v >> 8;
+        p[2] = v >> 16;
+        p[3] = v >> 24;
+      }
+
+      // closes the PNG chunk whose length field starts at p
+      void _endChunk(uint8_t *p)
+      {
+        uint32_t data = _len - (p - _piece) - 8;
+        _be32(p, data);
+        _be32(_piece + _len, crc::crc32(p + 4, data + 4));
+        _len += 4;
+      }
+
+      // builds the next piece, returns false at the end of the file
+      bool _fill()
+      {
+        if (!valid() || _row > _height)
+          return false;
+        _pos = 0;
+        _len = 0;
+        int32_t row = _row++;
+
+        if (_format == tCaptureFormat::kCaptureFormatPng)
+          _fillPng(row);
+        else if (_format == tCaptureFormat::kCaptureFormatBmp)
+          _fillBmp(row);
+        else if (row >= 0 && row < _height)
+        {
+          for (int32_t x = 0; x < _width; x++)
+            _le32(_piece + 4 * x, _pixels[row * _stride + x]);
+          _len = 4 * _width;
+        }
+        return _len > 0 || _fill();
+      }
+
+      void _fillPng(int32_t row)
+      {
+        uint8_t *p = _piece;
+        if (row < 0)
+        {
+          static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+          for (int32_t i = 0; i < 8; i++)
+            p[i] = signature[i];
+          p += 8;
+          _len = 8 + 8;
+          _be32(p + 4, 0x49484452); // IHDR
+          _be32(_piece + _len, _width);
+          _be32(_piece + _len + 4, _height);
+          _piece[_len + 8] = 8;  // bit depth
+          _piece[_len + 9] = 2;  // RGB
+          _piece[_len + 10] = 0; // deflate
+          _piece[_len + 11] = 0; // adaptive filtering
+          _piece[_len + 12] = 0; // not interlaced
+          _len += 13;
+          _endChunk(p);
+          return;
+        }
+        if (row == _height)
+        {
+          _len = 8;
+          _be32(p + 4, 0x49454E44); // IEND
+          _endChunk(p);
+          return;
+        }
+
+        // one IDAT chunk per row, each row one stored deflate block
+        _len = 8;
+        _be32(p + 4, 0x49444154); // IDAT
+        if (row == 0)
+        {
+          _piece[_len++] = 0x78;
+          _piece[_len++] = 0x01;
+        }
+        uint32_t raw = 1 + 3 * _width;
+        _piece[_len++] = row == _height - 1 ? 1 : 0;
+        _piece[_len++] = raw;
+        _piece[_len++] = raw >> 8;
+        _piece[_len++] = ~raw;
+        _piece[_len++] = ~raw >> 8;
+
+        uint8_t *d = _piece + _len;
+        d[0] = 0; // no filter
+        const uint32_t *src = _pixels + row * _stride;
+        for (int32_t x = 0; x < _width; x++)
+        {
+          d[1 + 3 * x] = src[x] >> 16;
+          d[2 + 3 * x] = src[x] >> 8;
+          d[3 + 3 * x] = src[x];
+        }
+        uint32_t a = _adler & 0xFFFF, b = _adler >> 16;
+        for (uint32_t i = 0; i < raw; i++)
+        {
+          a += d[i];
+          b += a;
+          if (a >= 65521)
+            a -= 65521;
+          if (b >= 65521 * 8)
+            b %= 65521;
+        }
+        _adler = ((b % 65521) << 16) | a;
+        _len += raw;
+
+        if (row == _height - 1)
+        {
+          _be32(_piece + _len, _adler);
+          _len += 4;
+        }
+        _endChunk(p);
+      }
+
+      void _fillBmp(int32_t row)
+      {
+        if (row < 0)
+        {
+          for (int32_t i = 0; i < 54; i++)
+            _piece[i] = 0;
+          _piece[0] = 'B';
+          _piece[1] = 'M';
+          _le32(_piece + 2, size());
+          _le32(_piece + 10, 54);
+          _le32(_piece + 14, 40);
+          _le32(_piece + 18, _width);
+          _le32(_piece + 22, -_height); // top down
+          _piece[26] = 1;
+          _piece[28] = 24;
+          _le32(_piece + 34, _height * _bmpStride());
+          _len = 54;
+          return;
+        }
+        if (row == _height)
+          return;
+
+        uint32_t stride = _bmpStride();
+        const uint32_t *src = _pixels + row * _stride;
+        for (int32_t x = 0; x < _width; x++)
+        {
+          _piece[3 * x] = src[x];
+          _piece[3 * x + 1] = src[x] >> 8;
+          _piece[3 * x + 2] = src[x] >> 16;
+        }
+        for (uint32_t i = 3 * _width; i < stride; i++)
+          _piece[i] = 0;
+        _len = stride;
+      }
+    };
+  };
+};
+
+#endif // VEX_CAPTUREFORMAT_H
@@ -0,0 +1,472 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_configstore.h                                           */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_CONFIGSTORE_CLASS_H
+#define VEX_CONFIGSTORE_CLASS_H
+
+#include <cstdlib>
+#include <cstring>
+
+#include "vex_crc.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_configstore.h
+ * @brief   Journaled key value store on the SD card class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief config store class                                                  */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define CONFIGSTORE_MAX_KEYS 128
+#define CONFIGSTORE_MAX_KEY 31
+#define CONFIGSTORE_MAX_VALUE 64
+#define CONFIGSTORE_MAX_NAME 32
+#define CONFIGSTORE_COMPACT (16 * 1024)
+
+#define CONFIGSTORE_MAGIC 0xC5
+#define CONFIGSTORE_SET 1
+#define CONFIGSTORE_ERASE 2
+#define CONFIGSTORE_GENERATION 3
+
+  /**
+   * @brief Use the configstore class to keep settings on the SD card that survive a power cut.
+   * @details
+   *  Every change is one record appended to a journal file and synced,
+   *  records carry a CRC32, so a record cut short by a power cut is ignored
+   *  when the journal is read and the key keeps its old value.  open() reads
+   *  the journal once into a hash table in memory, after that get() never
+   *  touches the SD card.
+   *  Once the journal is larger than CONFIGSTORE_COMPACT bytes and mostly old
+   *  values, the current values are written to a second file, name~, which
+   *  only takes over once its last record, a generation number, is on the
+   *  card.  open() uses whichever file has the highest generation.
+   *  Keys are at most CONFIGSTORE_MAX_KEY characters and values at most
+   *  CONFIGSTORE_MAX_VALUE bytes.  Numbers are stored in the brain's byte
+   *  order.
+   *
+   * @code
+   *  configstore config("config.kv");
+   *
+   *  config.open();
+   *  double kP = config.getDouble("drive.kP", 0.5);
+   *  config.setInt("auton", 3);
+   * @endcode
+   */
+  class configstore
+  {
+  public:
+    /**
+     * @brief Creates a new config store, nothing is read until open().
+     * @param name The name of the journal file.
+     */
+    configstore(const char *name)
+    {
+      if (name == nullptr)
+        name = "config.kv";
+      strncpy(_names[0], name, CONFIGSTORE_MAX_NAME - 2);
+      _names[0][CONFIGSTORE_MAX_NAME - 2] = 0;
+      strcpy(_names[1], _names[0]);
+      strcat(_names[1], "~");
+      _fp = nullptr;
+      _current = 0;
+      _generation = 0;
+      _size = 0;
+      _live = 0;
+      _skipped = 0;
+      _clear();
+    }
+    ~configstore() {};
+
+    configstore(const configstore &) = delete;
+    configstore &operator=(const configstore &) = delete;
+
+    /**
+     * @brief Reads the journal and opens it for changes.
+     * @return Returns true if the store can be used.
+     */
+    bool open()
+    {
+      if (_fp != nullptr)
+        return true;
+      if (!vexFileDriveStatus(0))
+        return false;
+
+      uint32_t generation[2] = {0, 0};
+      for (int32_t i = 0; i < 2; i++)
+        _read(i, false, generation[i]);
+
+      _clear();
+      _skipped = 0;
+      _current = generation[1] > generation[0] ? 1 : 0;
+      if (!_read(_current, true, _generation))
+        _size = 0;
+
+      _fp = vexFileOpenWrite(_names[_current]);
+      if (_fp == nullptr)
+        return false;
+      if (_generation == 0 && !_writeGeneration(_fp, 1))
+      {
+        close();
+        return false;
+      }
+      if (_generation == 0)
+        _generation = 1;
+      return true;
+    }
+
+    /**
+     * @brief Closes the journal, values can still be read.
+     */
+    void close()
+    {
+      if (_fp != nullptr)
+        vexFileClose(_fp);
+      _fp = nullptr;
+    }
+
+    /**
+     * @brief Checks if the store is open for changes.
+     * @return Returns true between open() and close().
+     */
+    bool isOpen() const { return _fp != nullptr; }
+
+    /**
+     * @brief Sets a value, the journal is synced before it returns.
+     * @return Returns true if the value is on the SD card.
+     * @param key The key.
+     * @param data Pointer to the value.
+     * @param len The length of the value in bytes, at most CONFIGSTORE_MAX_VALUE.
+     */
+    bool set(const char *key, const void *data, uint32_t len)
+    {
+      uint32_t keyLen = key != nullptr ? strlen(key) : 0;
+      if (_fp == nullptr || keyLen == 0 || keyLen > CONFIGSTORE_MAX_KEY || len > CONFIGSTORE_MAX_VALUE)
+        return false;
+
+      // an unchanged value is not written again
+      int32_t e = _find(key, keyLen);
+      if (e >= 0 && _entries[e].len == len && memcmp(_entries[e].value, data, len) == 0)
+        return true;
+      if (e < 0 && _count >= CONFIGSTORE_MAX_KEYS)
+        return false;
+
+      if (!_write(_fp, CONFIGSTORE_SET, key, keyLen, data, len))
+        return false;
+      _put(key, keyLen, data, len);
+
+      if (_size > CONFIGSTORE_COMPACT && _size > 4 * _live)
+        compact();
+      return true;
+    }
+
+    /**
+     * @brief Gets a value.
+     * @return Returns the length of the value, or -1 if the key is not set.
+     * @param key The key.
+     * @param data Pointer to a buffer for the value, may be nullptr to only get the length.
+     * @param len The length of the buffer in bytes.
+     */
+    int32_t get(const char *key, void *data, uint32_t len) const
+    {
+      int32_t e = key != nullptr ? _find(key, strlen(key)) : -1;
+      if (e < 0)
+        return -1;
+      if (data != nullptr)
+        memcpy(data, _entries[e].value, len < _entries[e].len ? len : _entries[e].len);
+      return _entries[e].len;
+    }
+
+    bool setInt(const char *key, int32_t value) { return set(key, &value, sizeof(value)); }
+    bool setDouble(const char *key, double value) { return set(key, &value, sizeof(value)); }
+    bool setString(const char *key, const char *value) { return value != nullptr && set(key, value, strlen(value)); }
+
+    /**
+     * @brief Gets an integer value.
+     * @return Returns the value, or def if the key is not set or is not an integer.
+     */
+    int32_t getInt(const char *key, int32_t def = 0) const
+    {
+      int32_t value;
+      return get(key, &value, sizeof(value)) == sizeof(value) ? value : def;
+    }
+
+    /**
+     * @brief Gets a double value.
+     * @return Returns the value, or def if the key is not set or is not a double.
+     */
+    double getDouble(const char *key, double def = 0) const
+    {
+      double value;
+      return get(key, &value, sizeof(value)) == sizeof(value) ? value : def;
+    }
+
+    /**
+     * @brief Gets a string value.
+     * @return Returns false if the key is not set, buffer is then an empty string.
+     * @param key The key.
+     * @param buffer Pointer to a buffer for the string, it is always terminated.
+     * @param len The length of the buffer in bytes.
+     */
+    bool getString(const char *key, char *buffer, uint32_t len) const
+    {
+      if (buffer == nullptr || len == 0)
+        return false;
+      int32_t n = get(key, buffer, len - 1);
+      buffer[n < 0 ? 0 : ((uint32_t)n < len - 1 ? n : len - 1)] = 0;
+      return n >= 0;
+    }
+
+    /**
+     * @brief Removes a key.
+     * @return Returns true if the key is not set anymore.
+     */
+    bool erase(const char *key)
+    {
+      uint32_t keyLen = key != nullptr ? strlen(key) : 0;
+      int32_t e = _find(key, keyLen);
+      if (e < 0)
+        return true;
+      if (_fp == nullptr || !_write(_fp, CONFIGSTORE_ERASE, key, keyLen, nullptr, 0))
+        return false;
+      _remove(e);
+      return true;
+    }
+
+    /**
+     * @brief Checks if a key is set.
+     * @return Returns true if the key has a value.
+     */
+    bool contains(const char *key) const { return key != nullptr && _find(key, strlen(key)) >= 0; }
+
+    /**
+     * @brief Writes the current values to the other journal file and switches to it.
+     * @return Returns true if the other file is complete and in use.
+     */
+    bool compact()
+    {
+      if (_fp == nullptr)
+        return false;
+      int32_t other = 1 - _current;
+      FIL *fp = vexFileOpenCreate(_names[other]);
+      if (fp == nullptr)
+        return false;
+
+      uint32_t size = _size;
+      _size = 0;
+      bool ok = true;
+      for (int32_t i = 0; i < _count && ok; i++)
+        ok = _write(fp, CONFIGSTORE_SET, _entries[i].key, _entries[i].keyLen, _entries[i].value, _entries[i].len);
+      // the file only counts once the generation is on the card
+      if (ok)
+        ok = _writeGeneration(fp, _generation + 1);
+      if (!ok)
+      {
+        vexFileClose(fp);
+        _size = size;
+        return false;
+      }
+
+      vexFileClose(_fp);
+      _fp = fp;
+      _current = other;
+      _generation++;
+      return true;
+    }
+
+    int32_t count() const { return _count; }
+    uint32_t size() const { return _size; }
+    uint32_t generation() const { return _generation; }
+    uint32_t skipped() const { return _skipped; }
+
+  private:
+    struct _entry
+    {
+      uint32_t hash;
+      uint8_t keyLen;
+      uint8_t len;
+      char key[CONFIGSTORE_MAX_KEY + 1];
+      uint8_t value[CONFIGSTORE_MAX_VALUE];
+    };
+
+    char _names[2][CONFIGSTORE_MAX_NAME];
+    FIL *_fp;
+    int32_t _current;      // file in use, 0 is name and 1 is name~
+    uint32_t _generation;  // generation of the file in use
+    uint32_t _size;        // bytes in the file in use
+    uint32_t _live;        // bytes the current values take as records
+    uint32_t _skipped;     // damaged bytes open() found
+    _entry _entries[CONFIGSTORE_MAX_KEYS];
+    int32_t _count;
+    int16_t _index[CONFIGSTORE_MAX_KEYS * 2]; // open addressing, -1 is empty
+
+    static uint32_t _hash(const char *key, uint32_t len)
+    {
+      uint32_t h = 2166136261u;
+      for (uint32_t i = 0; i < len; i++)
+        h = (h ^ (uint8_t)key[i]) * 16777619u;
+      return h;
+    }
+
+    static uint32_t _recordSize(uint32_t keyLen, uint32_t len) { return 4 + keyLen + len + 4; }
+
+    void _clear()
+    {
+      _count = 0;
+      _live = 0;
+      for (int16_t &i : _index)
+        i = -1;
+    }
+
+    int32_t _find(const char *key, uint32_t keyLen) const
+    {
+      if (keyLen == 0 || keyLen > CONFIGSTORE_MAX_KEY)
+        return -1;
+      uint32_t h = _hash(key, keyLen);
+      for (uint32_t s = h;; s++)
+      {
+        int16_t e = _index[s % (CONFIGSTORE_MAX_KEYS * 2)];
+        if (e < 0)
+          return -1;
+        const _entry &entry = _entries[e];
+        if (entry.hash == h && entry.keyLen == keyLen && memcmp(entry.key, key, keyLen) == 0)
+          return e;
+      }
+    }
+
+    void _insert(int32_t e)
+    {
+      uint32_t s = _entries[e].hash;
+      while (_index[s % (CONFIGSTORE_MAX_KEYS * 2)] >= 0)
+        s++;
+      _index[s % (CONFIGSTORE_MAX_KEYS * 2)] = e;
+    }
+
+    void _put(const char *key, uint32_t keyLen, const void *data, uint32_t len)
+    {
+      int32_t e = _find(key, keyLen);
+      if (e < 0)
+      {
+        if (_count >= CONFIGSTORE_MAX_KEYS)
+          return;
+        e = _count++;
+        _entry &entry = _entries[e];
+        entry.hash = _hash(key, keyLen);
+        entry.keyLen = keyLen;
+        memcpy(entry.key, key, keyLen);
+        entry.key[keyLen] = 0;
+        entry.len = 0;
+        _insert(e);
+        _live += _recordSize(keyLen, 0);
+      }
+      _live += len - _entries[e].len;
+      _entries[e].len = len;
+      memcpy(_entries[e].value, data, len);
+    }
+
+    void _remove(int32_t e)
+    {
+      _live -= _recordSize(_entries[e].keyLen, _entries[e].len);
+      _entries[e] = _entries[--_count];
+      for (int16_t &i : _index)
+        i = -1;
+      for (int32_t i = 0; i < _count; i++)
+        _insert(i);
+    }
+
+    bool _write(FIL *fp, uint8_t type, const char *key, uint32_t keyLen, const void *data, uint32_t len)
+    {
+      uint8_t rec[4 + CONFIGSTORE_MAX_KEY + CONFIGSTORE_MAX_VALUE + 4];
+      uint32_t n = 0;
+      rec[n++] = CONFIGSTORE_MAGIC;
+      rec[n++] = type;
+      rec[n++] = keyLen;
+      rec[n++] = len;
+      memcpy(rec + n, key, keyLen);
+      n += keyLen;
+      memcpy(rec + n, data, len);
+      n += len;
+      uint32_t check = crc::crc32(rec + 1, n - 1);
+      for (int32_t i = 0; i < 4; i++)
+        rec[n++] = check >> (8 * i);
+
+      if (vexFileWrite((char *)rec, 1, n, fp) != (int32_t)n)
+        return false;
+      vexFileSync(fp);
+      _size += n;
+      return true;
+    }
+
+    bool _writeGeneration(FIL *fp, uint32_t generation)
+    {
+      return _write(fp, CONFIGSTORE_GENERATION, "", 0, &generation, sizeof(generation));
+    }
+
+    // reads a journal file, finds its generation and optionally applies its records
+    bool _read(int32_t file, bool apply, uint32_t &generation)
+    {
+      generation = 0;
+      FIL *fp = vexFileOpen(_names[file], "");
+      if (fp == nullptr)
+        return false;
+      int32_t size = vexFileSize(fp);
+      uint8_t *data = size > 0 ? (uint8_t *)malloc(size) : nullptr;
+      bool ok = data != nullptr && vexFileRead((char *)data, 1, size, fp) == size;
+      vexFileClose(fp);
+      if (!ok)
+      {
+        free(data);
+        return false;
+      }
+
+      int32_t pos = 0;
+      while (pos < size)
+      {
+        const uint8_t *r = data + pos;
+        uint32_t n = size - pos >= 4 ? _recordSize(r[2], r[3]) : 0;
+        bool valid = n > 0 && r[0] == CONFIGSTORE_MAGIC && r[2] <= CONFIGSTORE_MAX_KEY && r[3] <= CONFIGSTORE_MAX_VALUE &&
+                     n <= (uint32_t)(size - pos) &&
+                     crc::crc32(r + 1, n - 5) == (r[n - 4] | (r[n - 3] << 8) | (r[n - 2] << 16) | ((uint32_t)r[n - 1] << 24));
+        if (!valid)
+        {
+          // a damaged record, try the next byte
+          pos++;
+          if (apply)
+            _skipped++;
+          continue;
+        }
+
+        const char *key = (const char *)r + 4;
+        const uint8_t *value = r + 4 + r[2];
+        if (r[1] == CONFIGSTORE_GENERATION && r[3] == sizeof(uint32_t))
+          memcpy(&generation, value, sizeof(uint32_t));
+        else if (apply && r[1] == CONFIGSTORE_SET && r[2] > 0)
+          _put(key, r[2], value, r[3]);
+        else if (apply && r[1] == CONFIGSTORE_ERASE)
+        {
+          int32_t e = _find(key, r[2]);
+          if (e >= 0)
+            _remove(e);
+        }
+        pos += n;
+      }
+
+      free(data);
+      if (apply)
+        _size = size;
+      return true;
+    }
+  };
+};
+
+#endif // VEX_CONFIGSTORE_CLASS_H
@@ -0,0 +1,53 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_crc.h                                                   */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_CRC_H
+#define VEX_CRC_H
+
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_crc.h
+ * @brief   CRC32 shared by the capture encoder and the config store
+ * @details
+ *  The standard reflected CRC32 used by PNG and zlib, computed a nibble at a
+ *  time from a 16 entry table so it costs 64 bytes of flash rather than 1K.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace crc
+  {
+    /**
+     * @brief Computes the CRC32 of a buffer.
+     * @return Returns the CRC.
+     * @param p The data.
+     * @param len The number of bytes.
+     */
+    inline uint32_t crc32(const uint8_t *p, uint32_t len)
+    {
+      static const uint32_t table[16] = {
+          0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+          0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+      uint32_t crc = 0xFFFFFFFF;
+      for (uint32_t i = 0; i < len; i++)
+      {
+        crc ^= p[i];
+        crc = (crc >> 4) ^ table[crc & 15];
+        crc = (crc >> 4) ^ table[crc & 15];
+      }
+      return crc ^ 0xFFFFFFFF;
+    }
+  };
+};
+
+#endif // VEX_CRC_H
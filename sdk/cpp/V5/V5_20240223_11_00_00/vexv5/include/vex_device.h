@@ -15,6 +15,7 @@
 #define VEX_DEVICE_CLASS_H
 
 #include "v5_apiprivate.h"
+#include <span>
 
 /*-----------------------------------------------------------------------------*/
 /** @file    vex_device.h
@@ -75,6 +76,12 @@ namespace vex
 
     T &operator[](int i);
     int getLength() { return length; };
+
+    // unchecked access to the whole array
+    T *data() { return arr; }
+    T *begin() { return arr; }
+    T *end() { return arr + len; }
+    std::span<T, len> span() { return std::span<T, len>(arr); }
   };
 
   template <class T, int len>
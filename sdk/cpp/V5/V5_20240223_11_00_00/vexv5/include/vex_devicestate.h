@@ -0,0 +1,215 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_devicestate.h                                           */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_DEVICESTATE_CLASS_H
+#define VEX_DEVICESTATE_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_devicestate.h
+ * @brief   Struct-of-arrays device state table header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief device state table class                                            */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+  /**
+   * @brief Use the devicestate class to read the state of many smart port devices from one contiguous table.
+   * @details
+   *  Each field is an array indexed by the zero-based port index, the same index
+   *  returned by device::index().  update() fetches every tracked port once and
+   *  skips ports whose device timestamp has not moved since the previous call,
+   *  so a control loop can read state[index] freely between device updates.
+   *  Values are raw, in the units returned by the vexDevice*Get functions.
+   *  V5 tasks are cooperative, call update() from one task only.
+   */
+  class devicestate
+  {
+  public:
+    devicestate()
+    {
+      clear();
+    }
+    ~devicestate() {};
+
+    /**
+     * @brief Adds a port to the set refreshed by update().
+     * @param index The port index to track. The index is zero-based.
+     */
+    void track(int32_t index)
+    {
+      if (index >= 0 && index < V5_MAX_DEVICE_PORTS)
+      {
+        _tracked |= (1UL << index);
+        _handle[index] = vexDeviceGetByIndex(index);
+        timestamp[index] = 0;
+      }
+    }
+
+    /**
+     * @brief Adds the port used by a device to the set refreshed by update().
+     * @param dev The device whose port is tracked.
+     */
+    void track(device &dev)
+    {
+      track(dev.index());
+    }
+
+    /**
+     * @brief Removes a port from the set refreshed by update().
+     * @param index The port index to stop tracking. The index is zero-based.
+     */
+    void untrack(int32_t index)
+    {
+      if (index >= 0 && index < V5_MAX_DEVICE_PORTS)
+        _tracked &= ~(1UL << index);
+    }
+
+    /**
+     * @brief Checks if a port is refreshed by update().
+     * @return Returns true if the port is tracked.
+     * @param index The port index. The index is zero-based.
+     */
+    bool tracked(int32_t index) const
+    {
+      return (index >= 0 && index < V5_MAX_DEVICE_PORTS && (_tracked & (1UL << index)) != 0);
+    }
+
+    /**
+     * @brief Refreshes all tracked ports that have new data.
+     * @return Returns the number of ports whose state was refreshed.
+     */
+    int32_t update()
+    {
+      int32_t count = 0;
+
+      // one call fetches the type of every port
+      vexDeviceGetStatus(type);
+
+      for (uint32_t mask = _tracked; mask != 0; mask &= mask - 1)
+      {
+        int32_t index = __builtin_ctz(mask);
+        V5_DeviceT dev = _handle[index];
+
+        uint32_t ts = (uint32_t)vexDeviceGetTimestamp(dev);
+        if (ts == timestamp[index] && ts != 0)
+          continue;
+        timestamp[index] = ts;
+
+        switch (type[index])
+        {
+        case kDeviceTypeMotorSensor:
+          motorPosition[index] = vexDeviceMotorPositionGet(dev);
+          motorVelocity[index] = vexDeviceMotorActualVelocityGet(dev);
+          motorCurrent[index] = vexDeviceMotorCurrentGet(dev);
+          motorVoltage[index] = vexDeviceMotorVoltageGet(dev);
+          motorTorque[index] = vexDeviceMotorTorqueGet(dev);
+          motorTemperature[index] = vexDeviceMotorTemperatureGet(dev);
+          motorFlags[index] = vexDeviceMotorFlagsGet(dev);
+          motorFaults[index] = vexDeviceMotorFaultsGet(dev);
+          break;
+
+        case kDeviceTypeAbsEncSensor:
+          rotationAngle[index] = vexDeviceAbsEncAngleGet(dev);
+          rotationPosition[index] = vexDeviceAbsEncPositionGet(dev);
+          rotationVelocity[index] = vexDeviceAbsEncVelocityGet(dev);
+          break;
+
+        case kDeviceTypeImuSensor:
+          imuHeading[index] = vexDeviceImuHeadingGet(dev);
+          imuRotation[index] = vexDeviceImuDegreesGet(dev);
+          vexDeviceImuAttitudeGet(dev, &imuAttitude[index]);
+          imuStatus[index] = vexDeviceImuStatusGet(dev);
+          break;
+
+        case kDeviceTypeDistanceSensor:
+          distanceValue[index] = vexDeviceDistanceDistanceGet(dev);
+          distanceConfidence[index] = vexDeviceDistanceConfidenceGet(dev);
+          break;
+
+        default:
+          break;
+        }
+        count++;
+      }
+
+      return count;
+    }
+
+    /**
+     * @brief Clears all state and stops tracking every port.
+     */
+    void clear()
+    {
+      _tracked = 0;
+      for (int32_t i = 0; i < V5_MAX_DEVICE_PORTS; i++)
+      {
+        _handle[i] = nullptr;
+        type[i] = kDeviceTypeNoSensor;
+        timestamp[i] = 0;
+        motorPosition[i] = 0;
+        motorVelocity[i] = 0;
+        motorCurrent[i] = 0;
+        motorVoltage[i] = 0;
+        motorTorque[i] = 0;
+        motorTemperature[i] = 0;
+        motorFlags[i] = 0;
+        motorFaults[i] = 0;
+        rotationAngle[i] = 0;
+        rotationPosition[i] = 0;
+        rotationVelocity[i] = 0;
+        imuHeading[i] = 0;
+        imuRotation[i] = 0;
+        imuAttitude[i] = V5_DeviceImuAttitude();
+        imuStatus[i] = 0;
+        distanceValue[i] = 0;
+        distanceConfidence[i] = 0;
+      }
+    }
+
+    // all ports
+    V5_DeviceType type[V5_MAX_DEVICE_PORTS];
+    uint32_t timestamp[V5_MAX_DEVICE_PORTS];
+
+    // motor, position in the motor encoder units, velocity in rpm, current in mA, voltage in mV
+    double motorPosition[V5_MAX_DEVICE_PORTS];
+    double motorVelocity[V5_MAX_DEVICE_PORTS];
+    int32_t motorCurrent[V5_MAX_DEVICE_PORTS];
+    int32_t motorVoltage[V5_MAX_DEVICE_PORTS];
+    double motorTorque[V5_MAX_DEVICE_PORTS];
+    double motorTemperature[V5_MAX_DEVICE_PORTS];
+    uint32_t motorFlags[V5_MAX_DEVICE_PORTS];
+    uint32_t motorFaults[V5_MAX_DEVICE_PORTS];
+
+    // rotation sensor, angle and position in centidegrees, velocity in centidegrees per second
+    int32_t rotationAngle[V5_MAX_DEVICE_PORTS];
+    int32_t rotationPosition[V5_MAX_DEVICE_PORTS];
+    int32_t rotationVelocity[V5_MAX_DEVICE_PORTS];
+
+    // inertial sensor, all angles in degrees
+    double imuHeading[V5_MAX_DEVICE_PORTS];
+    double imuRotation[V5_MAX_DEVICE_PORTS];
+    V5_DeviceImuAttitude imuAttitude[V5_MAX_DEVICE_PORTS];
+    uint32_t imuStatus[V5_MAX_DEVICE_PORTS];
+
+    // distance sensor, distance in mm
+    uint32_t distanceValue[V5_MAX_DEVICE_PORTS];
+    uint32_t distanceConfidence[V5_MAX_DEVICE_PORTS];
+
+  private:
+    uint32_t _tracked;
+    V5_DeviceT _handle[V5_MAX_DEVICE_PORTS];
+  };
+};
+
+#endif // VEX_DEVICESTATE_CLASS_H
@@ -0,0 +1,338 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_fileindex.h                                             */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_FILEINDEX_CLASS_H
+#define VEX_FILEINDEX_CLASS_H
+
+#include <cstdlib>
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_fileindex.h
+ * @brief   SD card file index and prefetch class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief file index class                                                    */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define FILEINDEX_MAX_FILES 128
+#define FILEINDEX_MAX_NAME 48
+#define FILEINDEX_LISTING 4096
+#define FILEINDEX_CHUNK 4096
+#define FILEINDEX_IDLE 20
+
+  /**
+   * @brief Use the fileindex class to look up and preload SD card files before a match starts.
+   * @details
+   *  scan() lists a directory with vexFileDirectoryGet once and records the
+   *  size of every file in a hash table, after that exists() and size() are
+   *  answered from memory instead of asking the SD card each time like
+   *  brain::sdcard does.  Call it in pre autonomous, it opens every file
+   *  once.
+   *  prefetch() queues a file to be read into memory by a low priority task,
+   *  FILEINDEX_CHUNK bytes at a time with a yield after each, data() then
+   *  returns it, for example for lcd::drawImageFromBuffer, imagecache or a
+   *  path follower.  data() returns nullptr until the file is loaded, it
+   *  never waits.  Files added to the SD card after scan() are not seen.
+   *  Keep the object for the whole program, usually as a global, the loader
+   *  task keeps using it.
+   *
+   * @code
+   *  fileindex files;
+   *
+   *  void pre_auton() {
+   *    files.scan();
+   *    files.scan("paths");
+   *    files.prefetch("paths/skills.txt");
+   *    files.prefetch("logo.png");
+   *  }
+   *
+   *  int32_t len;
+   *  const uint8_t *path = files.data("paths/skills.txt", &len);
+   * @endcode
+   */
+  class fileindex
+  {
+  public:
+    /**
+     * @brief Creates a new empty file index.
+     * @param priority The priority of the loader task.
+     */
+    fileindex(int32_t priority = task::taskPrioritylow) : _priority(priority)
+    {
+      _count = 0;
+      _started = false;
+      _queued = 0;
+      _loaded = 0;
+      for (int16_t &i : _index)
+        i = -1;
+    }
+    ~fileindex() {};
+
+    fileindex(const fileindex &) = delete;
+    fileindex &operator=(const fileindex &) = delete;
+
+    /**
+     * @brief Adds the files in a directory to the index.
+     * @return Returns the number of files added, or -1 if the directory cannot be read.
+     * @param path The directory, "" is the root of the SD card.
+     */
+    int32_t scan(const char *path = "")
+    {
+      if (path == nullptr || !vexFileDriveStatus(0))
+        return -1;
+      char *listing = (char *)malloc(FILEINDEX_LISTING);
+      if (listing == nullptr)
+        return -1;
+      memset(listing, 0, FILEINDEX_LISTING);
+      if (vexFileDirectoryGet(path, listing, FILEINDEX_LISTING - 1) != FR_OK)
+      {
+        free(listing);
+        return -1;
+      }
+
+      // names are separated by new lines
+      int32_t added = 0;
+      uint32_t pathLen = strlen(path);
+      char *p = listing;
+      while (*p != 0)
+      {
+        char *end = p;
+        while (*end != 0 && *end != '\n' && *end != '\r')
+          end++;
+        uint32_t len = end - p;
+        char name[FILEINDEX_MAX_NAME];
+        if (len > 0 && pathLen + 1 + len < FILEINDEX_MAX_NAME)
+        {
+          uint32_t n = 0;
+          if (pathLen > 0)
+          {
+            memcpy(name, path, pathLen);
+            n = pathLen;
+            if (path[pathLen - 1] != '/')
+              name[n++] = '/';
+          }
+          memcpy(name + n, p, len);
+          name[n + len] = 0;
+          if (_add(name))
+            added++;
+        }
+        p = *end != 0 ? end + 1 : end;
+      }
+      free(listing);
+      return added;
+    }
+
+    /**
+     * @brief Checks if a file was found by scan().
+     * @return Returns true if the file is in the index.
+     * @param name The file name, including its directory.
+     */
+    bool exists(const char *name) const { return _find(name) >= 0; }
+
+    /**
+     * @brief Gets the size of a file found by scan().
+     * @return Returns the size in bytes, or -1 if the file is not in the index.
+     * @param name The file name, including its directory.
+     */
+    int32_t size(const char *name) const
+    {
+      int32_t e = _find(name);
+      return e >= 0 ? _entries[e].size : -1;
+    }
+
+    /**
+     * @brief Queues a file to be read into memory by the loader task.
+     * @return Returns false if the file is not in the index.
+     * @param name The file name, including its directory.
+     */
+    bool prefetch(const char *name)
+    {
+      int32_t e = _find(name);
+      if (e < 0)
+        return false;
+      if (_entries[e].state == _stateIdle)
+      {
+        _entries[e].state = _stateQueued;
+        _queued = _queued + 1;
+      }
+      if (!_started)
+      {
+        _started = true;
+        _task = task(_loader, this, _priority);
+      }
+      return true;
+    }
+
+    /**
+     * @brief Gets a file read by prefetch().
+     * @return Returns a pointer to the file contents, or nullptr if it is not loaded yet.
+     * @param name The file name, including its directory.
+     * @param len Set to the length of the file if it is not nullptr.
+     */
+    const uint8_t *data(const char *name, int32_t *len = nullptr) const
+    {
+      int32_t e = _find(name);
+      if (e < 0 || _entries[e].state != _stateReady)
+        return nullptr;
+      if (len != nullptr)
+        *len = _entries[e].size;
+      return _entries[e].data;
+    }
+
+    /**
+     * @brief Frees the memory of a file read by prefetch().
+     * @param name The file name, including its directory.
+     */
+    void release(const char *name)
+    {
+      int32_t e = _find(name);
+      if (e < 0 || _entries[e].state != _stateReady)
+        return;
+      free(_entries[e].data);
+      _entries[e].data = nullptr;
+      _entries[e].state = _stateIdle;
+    }
+
+    /**
+     * @brief Checks if every queued file has been read.
+     * @return Returns true when the loader task has nothing left to do.
+     */
+    bool prefetched() const { return _queued == 0; }
+
+    int32_t count() const { return _count; }
+    const char *name(int32_t index) const { return index >= 0 && index < _count ? _entries[index].name : nullptr; }
+    uint32_t loaded() const { return _loaded; }
+
+  private:
+    enum _state : uint8_t
+    {
+      _stateIdle = 0,
+      _stateQueued,
+      _stateReady,
+      _stateFailed
+    };
+
+    struct _entry
+    {
+      uint32_t hash;
+      int32_t size;
+      uint8_t *data;
+      volatile _state state;
+      char name[FILEINDEX_MAX_NAME];
+    };
+
+    int32_t _priority;
+    task _task;
+    bool _started;
+    volatile int32_t _queued; // files waiting for the loader task
+    uint32_t _loaded;         // bytes read by the loader task
+    _entry _entries[FILEINDEX_MAX_FILES];
+    int32_t _count;
+    int16_t _index[FILEINDEX_MAX_FILES * 2]; // open addressing, -1 is empty
+
+    static uint32_t _hash(const char *name)
+    {
+      uint32_t h = 2166136261u;
+      while (*name != 0)
+        h = (h ^ (uint8_t)*name++) * 16777619u;
+      return h;
+    }
+
+    int32_t _find(const char *name) const
+    {
+      if (name == nullptr)
+        return -1;
+      uint32_t h = _hash(name);
+      for (uint32_t s = h;; s++)
+      {
+        int16_t e = _index[s % (FILEINDEX_MAX_FILES * 2)];
+        if (e < 0)
+          return -1;
+        if (_entries[e].hash == h && strcmp(_entries[e].name, name) == 0)
+          return e;
+      }
+    }
+
+    bool _add(const char *name)
+    {
+      if (_count >= FILEINDEX_MAX_FILES || _find(name) >= 0)
+        return false;
+
+      // directories cannot be opened and are left out
+      FIL *fp = vexFileOpen(name, "");
+      if (fp == nullptr)
+        return false;
+      int32_t size = vexFileSize(fp);
+      vexFileClose(fp);
+      if (size < 0)
+        return false;
+
+      _entry &e = _entries[_count];
+      e.hash = _hash(name);
+      e.size = size;
+      e.data = nullptr;
+      e.state = _stateIdle;
+      strcpy(e.name, name);
+      uint32_t s = e.hash;
+      while (_index[s % (FILEINDEX_MAX_FILES * 2)] >= 0)
+        s++;
+      _index[s % (FILEINDEX_MAX_FILES * 2)] = _count++;
+      return true;
+    }
+
+    static int _loader(void *arg)
+    {
+      fileindex *self = (fileindex *)arg;
+      while (true)
+      {
+        int32_t e = 0;
+        while (e < self->_count && self->_entries[e].state != _stateQueued)
+          e++;
+        if (e < self->_count)
+          self->_load(self->_entries[e]);
+        else
+          task::sleep(FILEINDEX_IDLE);
+      }
+      return 0;
+    }
+
+    void _load(_entry &e)
+    {
+      uint8_t *data = (uint8_t *)malloc(e.size > 0 ? e.size : 1);
+      FIL *fp = data != nullptr ? vexFileOpen(e.name, "") : nullptr;
+      bool ok = fp != nullptr;
+      for (int32_t pos = 0; ok && pos < e.size; pos += FILEINDEX_CHUNK)
+      {
+        int32_t n = e.size - pos < FILEINDEX_CHUNK ? e.size - pos : FILEINDEX_CHUNK;
+        ok = vexFileRead((char *)data + pos, 1, n, fp) == n;
+        task::yield();
+      }
+      if (fp != nullptr)
+        vexFileClose(fp);
+
+      if (ok)
+      {
+        e.data = data;
+        _loaded += e.size;
+      }
+      else
+        free(data);
+      e.state = ok ? _stateReady : _stateFailed;
+      _queued = _queued - 1;
+    }
+  };
+};
+
+#endif // VEX_FILEINDEX_CLASS_H
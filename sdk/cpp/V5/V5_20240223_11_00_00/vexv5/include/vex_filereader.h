@@ -0,0 +1,334 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_filereader.h                                            */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_FILEREADER_CLASS_H
+#define VEX_FILEREADER_CLASS_H
+
+#include <cstring>
+#include <span>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_filereader.h
+ * @brief   Buffered streaming file reader class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief file reader class                                                   */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define FILEREADER_SECTOR 512
+#define FILEREADER_BUFFER (16 * FILEREADER_SECTOR)
+#define FILEREADER_MAX_VIEW (FILEREADER_BUFFER - FILEREADER_SECTOR)
+
+  /**
+   * @brief Use the filereader class to read a large file a piece at a time.
+   * @details
+   *  The file is read ahead into a FILEREADER_BUFFER byte buffer with reads
+   *  that start on a sector boundary of the file and of the buffer and are
+   *  whole sectors long, so the file system copies sectors straight into the
+   *  buffer.  Memory use does not depend on the size of the file.
+   *  next() and line() return a std::span into the buffer instead of copying,
+   *  it stays valid until the next call on the reader.  A view is at most
+   *  FILEREADER_MAX_VIEW bytes, longer lines are returned in pieces.
+   *  read() copies, large reads go straight from the file to the caller.
+   *
+   * @code
+   *  filereader path("paths/skills.csv");
+   *  std::span<const char> line;
+   *
+   *  while (path.line(line)) {
+   *    // line is not terminated, copy it before using C string functions
+   *    char text[64];
+   *    size_t n = line.size() < sizeof(text) - 1 ? line.size() : sizeof(text) - 1;
+   *    memcpy(text, line.data(), n);
+   *    text[n] = 0;
+   *
+   *    double x, y;
+   *    sscanf(text, "%lf,%lf", &x, &y);
+   *  }
+   * @endcode
+   */
+  class filereader
+  {
+  public:
+    /**
+     * @brief Creates a new reader, nothing is opened.
+     */
+    filereader()
+    {
+      _fp = nullptr;
+      _size = 0;
+      _reset(0);
+    }
+
+    /**
+     * @brief Creates a new reader and opens a file.
+     * @param name The name of the file.
+     */
+    filereader(const char *name) : filereader() { open(name); }
+    ~filereader() { close(); };
+
+    filereader(const filereader &) = delete;
+    filereader &operator=(const filereader &) = delete;
+
+    /**
+     * @brief Opens a file, a file that is already open is closed.
+     * @return Returns true if the file is open.
+     * @param name The name of the file.
+     */
+    bool open(const char *name)
+    {
+      close();
+      if (name == nullptr || !vexFileDriveStatus(0))
+        return false;
+      _fp = vexFileOpen(name, "");
+      if (_fp == nullptr)
+        return false;
+      int32_t size = vexFileSize(_fp);
+      _size = size > 0 ? size : 0;
+      _reset(0);
+      return true;
+    }
+
+    /**
+     * @brief Closes the file.
+     */
+    void close()
+    {
+      if (_fp != nullptr)
+        vexFileClose(_fp);
+      _fp = nullptr;
+      _size = 0;
+      _reset(0);
+    }
+
+    bool isOpen() const { return _fp != nullptr; }
+    uint32_t size() const { return _size; }
+
+    /**
+     * @brief Gets the position of the next byte to be read.
+     * @return Returns the offset from the start of the file in bytes.
+     */
+    uint32_t position() const { return _fileEnd - (_end - _pos); }
+
+    /**
+     * @brief Checks if everything has been read.
+     * @return Returns true at the end of the file or after a read error.
+     */
+    bool eof() const { return _pos == _end && (_fileEnd >= _size || _error); }
+
+    /**
+     * @brief Gets the next bytes without using them up.
+     * @return Returns a view of up to len bytes, shorter at the end of the file.
+     * @param len The number of bytes wanted, at most FILEREADER_MAX_VIEW.
+     */
+    std::span<const uint8_t> peek(uint32_t len)
+    {
+      if (len > FILEREADER_MAX_VIEW)
+        len = FILEREADER_MAX_VIEW;
+      if (_end - _pos < len)
+        _fill();
+      uint32_t n = _end - _pos < len ? _end - _pos : len;
+      return std::span<const uint8_t>(_buffer + _pos, n);
+    }
+
+    /**
+     * @brief Gets the next bytes.
+     * @return Returns a view of up to len bytes, shorter at the end of the file.
+     * @param len The number of bytes wanted, at most FILEREADER_MAX_VIEW.
+     */
+    std::span<const uint8_t> next(uint32_t len)
+    {
+      std::span<const uint8_t> s = peek(len);
+      _pos += s.size();
+      return s;
+    }
+
+    /**
+     * @brief Gets the next line, without its line end.
+     * @return Returns false at the end of the file.
+     * @param line Set to a view of the line.
+     */
+    bool line(std::span<const char> &line)
+    {
+      uint8_t *nl = _findLine();
+      if (nl == nullptr && _end - _pos < FILEREADER_MAX_VIEW && !eof())
+      {
+        _fill();
+        nl = _findLine();
+      }
+      if (nl == nullptr && _pos == _end)
+        return false;
+
+      const char *start = (const char *)_buffer + _pos;
+      uint32_t len;
+      if (nl != nullptr)
+      {
+        len = nl - (_buffer + _pos);
+        _pos += len + 1;
+      }
+      else
+      {
+        // the last line, or a piece of one that does not fit
+        len = _end - _pos < FILEREADER_MAX_VIEW ? _end - _pos : FILEREADER_MAX_VIEW;
+        _pos += len;
+      }
+      if (len > 0 && start[len - 1] == '\r')
+        len--;
+      line = std::span<const char>(start, len);
+      return true;
+    }
+
+    /**
+     * @brief Copies the next bytes.
+     * @return Returns the number of bytes copied, shorter at the end of the file.
+     * @param data Pointer to a buffer for the bytes.
+     * @param len The number of bytes wanted.
+     */
+    int32_t read(void *data, uint32_t len)
+    {
+      uint8_t *dst = (uint8_t *)data;
+      uint32_t done = 0;
+      while (done < len)
+      {
+        uint32_t left = len - done;
+        // whole sectors skip the buffer once it is used up
+        if (_pos == _end && left >= FILEREADER_BUFFER && _fileEnd % FILEREADER_SECTOR == 0 && _fp != nullptr && !_error)
+        {
+          uint32_t n = left & ~(FILEREADER_SECTOR - 1);
+          int32_t got = vexFileRead((char *)dst + done, 1, n, _fp);
+          if (got <= 0)
+          {
+            _error = got < 0;
+            break;
+          }
+          done += got;
+          _reset(_fileEnd + got);
+          if ((uint32_t)got < n)
+            break;
+          continue;
+        }
+        std::span<const uint8_t> s = next(left);
+        if (s.empty())
+          break;
+        memcpy(dst + done, s.data(), s.size());
+        done += s.size();
+      }
+      return done;
+    }
+
+    /**
+     * @brief Copies a value stored as its bytes.
+     * @return Returns false if the file ends first.
+     * @param value The value read.
+     */
+    template <class T>
+    bool read(T &value)
+    {
+      return read(&value, sizeof(T)) == (int32_t)sizeof(T);
+    }
+
+    /**
+     * @brief Skips bytes.
+     * @return Returns false if that is past the end of the file.
+     * @param len The number of bytes to skip.
+     */
+    bool skip(uint32_t len)
+    {
+      if (len <= _end - _pos)
+      {
+        _pos += len;
+        return true;
+      }
+      return seek(position() + len);
+    }
+
+    /**
+     * @brief Moves to a position in the file.
+     * @return Returns false if the position is past the end of the file or cannot be reached.
+     * @param offset The offset from the start of the file in bytes.
+     */
+    bool seek(uint32_t offset)
+    {
+      if (_fp == nullptr || offset > _size)
+        return false;
+      // still in the buffer
+      uint32_t start = _fileEnd - (_end - _start);
+      if (offset >= start && offset <= _fileEnd)
+      {
+        _pos = _start + (offset - start);
+        return true;
+      }
+
+      uint32_t base = offset & ~(FILEREADER_SECTOR - 1);
+      if (vexFileSeek(_fp, base, FS_SEEK_SET) != FR_OK)
+        return false;
+      _reset(base);
+      _fill();
+      if (offset - base > _end - _pos)
+        return false;
+      _pos += offset - base;
+      return true;
+    }
+
+  private:
+    FIL *_fp;
+    uint32_t _size;
+    uint32_t _fileEnd; // file offset of _buffer[_end]
+    uint32_t _start;   // first valid byte in the buffer
+    uint32_t _pos;     // next byte to be used
+    uint32_t _end;     // end of the valid bytes
+    bool _error;
+    uint8_t _buffer[FILEREADER_BUFFER] __attribute__((aligned(32)));
+
+    void _reset(uint32_t fileOffset)
+    {
+      _fileEnd = fileOffset;
+      _start = 0;
+      _pos = 0;
+      _end = 0;
+      _error = false;
+    }
+
+    uint8_t *_findLine()
+    {
+      return (uint8_t *)memchr(_buffer + _pos, '\n', _end - _pos);
+    }
+
+    // reads as much as fits, the bytes not used yet are moved so new data
+    // still lands on a sector boundary
+    void _fill()
+    {
+      if (_fp == nullptr || _error || _fileEnd >= _size)
+        return;
+      uint32_t tail = _end - _pos;
+      uint32_t dst = (tail + FILEREADER_SECTOR - 1) & ~(FILEREADER_SECTOR - 1);
+      memmove(_buffer + dst - tail, _buffer + _pos, tail);
+      _start = _pos = dst - tail;
+      _end = dst;
+      if (_end >= FILEREADER_BUFFER)
+        return;
+
+      uint32_t n = FILEREADER_BUFFER - _end;
+      int32_t got = vexFileRead((char *)_buffer + _end, 1, n, _fp);
+      if (got < 0)
+        _error = true;
+      if (got <= 0)
+        return;
+      _end += got;
+      _fileEnd += got;
+    }
+  };
+};
+
+#endif // VEX_FILEREADER_CLASS_H
@@ -0,0 +1,327 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_framegovernor.h                                         */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_FRAMEGOVERNOR_CLASS_H
+#define VEX_FRAMEGOVERNOR_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_framegovernor.h
+ * @brief   User interface frame rate governor class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief control loop monitor class                                          */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define LOOPMONITOR_STOPPED_PERIODS 20
+
+  /**
+   * @brief Use the loopmonitor class to measure how late a periodic control loop runs.
+   * @details
+   *  Call tick() once per loop iteration.  A loop is late when the time since
+   *  the previous tick is longer than its period, or when it is overdue now.
+   *  V5 tasks are cooperative, so an overdue control loop usually means some
+   *  other task, often screen drawing, has not yielded.
+   *  A loop that has not ticked for LOOPMONITOR_STOPPED_PERIODS periods is
+   *  taken to have stopped, its task ended or waits on purpose, and is no
+   *  longer late.  It counts again from its next tick.
+   */
+  class loopmonitor
+  {
+  public:
+    /**
+     * @brief Creates a new loop monitor.
+     * @param period The loop period in mS.
+     */
+    loopmonitor(uint32_t period) : _periodUs(period * 1000)
+    {
+      reset();
+    }
+    ~loopmonitor() {};
+
+    /**
+     * @brief Records one iteration of the loop.
+     */
+    void tick()
+    {
+      uint64_t now = vexSystemHighResTimeGet();
+      if (_last != 0)
+      {
+        uint64_t interval = now - _last;
+        _lateness = interval > _periodUs ? (uint32_t)(interval - _periodUs) : 0;
+        if (_lateness > _maxLateness)
+          _maxLateness = _lateness;
+        if (_lateness > 0)
+          _overruns++;
+      }
+      _last = now;
+      _iterations++;
+    }
+
+    /**
+     * @brief Checks if the loop is running late.
+     * @return Returns true if the last iteration or the one now due is later than the tolerance.
+     * @param toleranceUs The lateness allowed in uS.
+     */
+    bool late(uint32_t toleranceUs) const
+    {
+      if (_last == 0)
+        return false;
+      uint64_t since = vexSystemHighResTimeGet() - _last;
+      if (since > (uint64_t)_periodUs * LOOPMONITOR_STOPPED_PERIODS)
+        return false;
+      return _lateness > toleranceUs || since > (uint64_t)_periodUs + toleranceUs;
+    }
+
+    /**
+     * @brief Checks if the loop has stopped ticking.
+     * @return Returns true if the loop has not ticked for LOOPMONITOR_STOPPED_PERIODS periods.
+     */
+    bool stopped() const
+    {
+      return _last != 0 && vexSystemHighResTimeGet() - _last > (uint64_t)_periodUs * LOOPMONITOR_STOPPED_PERIODS;
+    }
+
+    /**
+     * @brief Clears the statistics.
+     */
+    void reset()
+    {
+      _last = 0;
+      _lateness = 0;
+      _maxLateness = 0;
+      _overruns = 0;
+      _iterations = 0;
+    }
+
+    uint32_t period() const { return _periodUs / 1000; }
+    uint32_t lateness() const { return _lateness; }
+    uint32_t maxLateness() const { return _maxLateness; }
+    uint32_t overruns() const { return _overruns; }
+    uint32_t iterations() const { return _iterations; }
+
+  private:
+    uint32_t _periodUs;
+    uint64_t _last;
+    uint32_t _lateness;
+    uint32_t _maxLateness;
+    uint32_t _overruns;
+    uint32_t _iterations;
+  };
+};
+
+/*-----------------------------------------------------------------------------*/
+/** @brief frame governor class                                                */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define FRAMEGOVERNOR_MAX_LOOPS 8
+
+  /**
+   * @brief Use the framegovernor class to limit screen drawing to a frame rate and CPU budget.
+   * @details
+   *  A user interface task asks beginFrame() before drawing.  A frame is
+   *  dropped when
+   *    it is not yet due at the target frame rate
+   *    any watched control loop is late
+   *    the previous frame took longer than the budget, one frame is dropped
+   *    for each whole budget it went over
+   *  Dropped frames are not made up later, the next frame is scheduled one
+   *  period on.  run() is a complete user interface task loop.
+   *  A watched loop that stops ticking only drops frames until
+   *  loopmonitor::stopped(), a loop that is ended on purpose should be
+   *  removed with unwatch().
+   *
+   * @code
+   *  loopmonitor drive(10);
+   *  framegovernor ui(30, 4000);
+   *
+   *  int uiTask() {
+   *    ui.watch(drive);
+   *    ui.run(drawScreen);
+   *    return 0;
+   *  }
+   * @endcode
+   */
+  class framegovernor
+  {
+  public:
+    /**
+     * @brief Creates a new frame governor.
+     * @param fps The target frame rate.
+     * @param budgetUs The CPU time one frame may use in uS.
+     * @param toleranceUs The lateness allowed for watched control loops in uS.
+     */
+    framegovernor(double fps = 30, uint32_t budgetUs = 5000, uint32_t toleranceUs = 1000)
+    {
+      setFrameRate(fps);
+      _budgetUs = budgetUs;
+      _toleranceUs = toleranceUs;
+      _loopCount = 0;
+      _next = 0;
+      _start = 0;
+      _skip = 0;
+      _frameUs = 0;
+      _maxFrameUs = 0;
+      _drawn = 0;
+      _droppedLate = 0;
+      _droppedBudget = 0;
+    }
+    ~framegovernor() {};
+
+    /**
+     * @brief Sets the target frame rate.
+     * @param fps The frame rate, frames per second.
+     */
+    void setFrameRate(double fps)
+    {
+      _periodUs = fps > 0 ? (uint32_t)(1000000.0 / fps) : 1000000;
+    }
+
+    /**
+     * @brief Sets the CPU time one frame may use.
+     * @param budgetUs The budget in uS.
+     */
+    void setBudget(uint32_t budgetUs) { _budgetUs = budgetUs; }
+
+    /**
+     * @brief Adds a control loop whose lateness causes frames to be dropped.
+     * @return Returns false if FRAMEGOVERNOR_MAX_LOOPS loops are already watched.
+     * @param loop The control loop monitor.
+     */
+    bool watch(loopmonitor &loop)
+    {
+      if (_loopCount >= FRAMEGOVERNOR_MAX_LOOPS)
+        return false;
+      _loops[_loopCount++] = &loop;
+      return true;
+    }
+
+    /**
+     * @brief Removes a control loop added with watch().
+     * @return Returns false if the loop is not watched.
+     * @param loop The control loop monitor.
+     */
+    bool unwatch(loopmonitor &loop)
+    {
+      for (int32_t i = 0; i < _loopCount; i++)
+      {
+        if (_loops[i] == &loop)
+        {
+          _loops[i] = _loops[--_loopCount];
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /**
+     * @brief Decides if a frame should be drawn now.
+     * @return Returns true if the caller should draw a frame and then call endFrame().
+     */
+    bool beginFrame()
+    {
+      uint64_t now = vexSystemHighResTimeGet();
+      if (now < _next)
+        return false;
+
+      // the frame slot is used up whether it is drawn or not
+      _next = (_next == 0 || now - _next > _periodUs) ? now + _periodUs : _next + _periodUs;
+
+      if (_skip > 0)
+      {
+        _skip--;
+        _droppedBudget++;
+        return false;
+      }
+
+      for (int32_t i = 0; i < _loopCount; i++)
+      {
+        if (_loops[i]->late(_toleranceUs))
+        {
+          _droppedLate++;
+          return false;
+        }
+      }
+
+      _start = now;
+      return true;
+    }
+
+    /**
+     * @brief Ends a frame started by beginFrame().
+     */
+    void endFrame()
+    {
+      if (_start == 0)
+        return;
+      _frameUs = (uint32_t)(vexSystemHighResTimeGet() - _start);
+      _start = 0;
+      if (_frameUs > _maxFrameUs)
+        _maxFrameUs = _frameUs;
+      _skip = _budgetUs > 0 && _frameUs > _budgetUs ? (_frameUs - 1) / _budgetUs : 0;
+      _drawn++;
+    }
+
+    /**
+     * @brief Gets the time until the next frame is due.
+     * @return Returns the time in mS, suitable for task::sleep().
+     */
+    uint32_t sleepTime() const
+    {
+      uint64_t now = vexSystemHighResTimeGet();
+      return _next > now ? (uint32_t)((_next - now + 999) / 1000) : 0;
+    }
+
+    /**
+     * @brief Runs a user interface loop forever, drawing frames as the governor allows.
+     * @param draw The function that draws one frame.
+     */
+    void run(void (*draw)(void))
+    {
+      while (true)
+      {
+        if (beginFrame())
+        {
+          draw();
+          endFrame();
+        }
+        uint32_t ms = sleepTime();
+        task::sleep(ms > 0 ? ms : 1);
+      }
+    }
+
+    uint32_t frameTime() const { return _frameUs; }
+    uint32_t maxFrameTime() const { return _maxFrameUs; }
+    uint32_t framesDrawn() const { return _drawn; }
+    uint32_t framesDroppedLate() const { return _droppedLate; }
+    uint32_t framesDroppedBudget() const { return _droppedBudget; }
+
+  private:
+    uint32_t _periodUs;
+    uint32_t _budgetUs;
+    uint32_t _toleranceUs;
+    loopmonitor *_loops[FRAMEGOVERNOR_MAX_LOOPS];
+    int32_t _loopCount;
+    uint64_t _next;
+    uint64_t _start;
+    uint32_t _skip;
+    uint32_t _frameUs;
+    uint32_t _maxFrameUs;
+    uint32_t _drawn;
+    uint32_t _droppedLate;
+    uint32_t _droppedBudget;
+  };
+};
+
+#endif // VEX_FRAMEGOVERNOR_CLASS_H
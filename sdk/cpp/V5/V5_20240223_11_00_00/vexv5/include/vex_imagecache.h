@@ -0,0 +1,358 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_imagecache.h                                            */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_IMAGECACHE_CLASS_H
+#define VEX_IMAGECACHE_CLASS_H
+
+#include <cstdlib>
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_imagecache.h
+ * @brief   Decoded image cache class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief decoded image cache class                                           */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+  /**
+   * @brief Use the imagecache class to draw BMP and PNG images without decoding them every time.
+   * @details
+   *  The first draw of an image reads it, decodes it with vexImageBmpRead or
+   *  vexImagePngRead and keeps the raw pixels.  Later draws copy the pixels
+   *  straight to the screen with lcd::drawImageFromBuffer, so the lcd origin
+   *  applies as usual.  Files are keyed by name, buffers by a hash of their
+   *  contents.  When the pixels held would exceed the budget the least
+   *  recently drawn images are dropped, an image larger than the whole budget
+   *  is drawn but not kept.
+   *  Decoding uses the scratch memory, like lcd::drawImageFromFile.
+   */
+  class imagecache
+  {
+  public:
+    /**
+     * @brief A decoded image, 32 bit 0x00RRGGBB pixels with no padding between rows.
+     */
+    struct image
+    {
+      uint32_t *data;
+      int32_t width;
+      int32_t height;
+    };
+
+    /**
+     * @brief Creates a new image cache.
+     * @param screen The screen images are drawn on.
+     * @param budget The maximum number of bytes of pixels to keep.
+     */
+    imagecache(brain::lcd &screen, uint32_t budget = 1024 * 1024) : _screen(screen), _budget(budget)
+    {
+      _head = nullptr;
+      _tail = nullptr;
+      _used = 0;
+      _hits = 0;
+      _misses = 0;
+    }
+    ~imagecache()
+    {
+      clear();
+    }
+
+    imagecache(const imagecache &) = delete;
+    imagecache &operator=(const imagecache &) = delete;
+
+    /**
+     * @brief Draws an image from a file on the SD card.
+     * @return Returns true if the image was drawn.
+     * @param name The name of the image, a ".bmp" or ".png" file.
+     * @param x The x-coordinate at which the left edge of the image will be drawn.
+     * @param y The y-coordinate at which the top edge of the image will be drawn.
+     */
+    bool drawImageFromFile(const char *name, int x, int y)
+    {
+      _entry *e = _load(name);
+      return _draw(e, x, y);
+    }
+
+    /**
+     * @brief Draws an image from a buffer containing a BMP or PNG file.
+     * @return Returns true if the image was drawn.
+     * @param buffer Pointer to the file contents.
+     * @param x The x-coordinate at which the left edge of the image will be drawn.
+     * @param y The y-coordinate at which the top edge of the image will be drawn.
+     * @param bufferLen The length of the buffer in bytes.
+     */
+    bool drawImageFromBuffer(const uint8_t *buffer, int x, int y, int bufferLen)
+    {
+      _entry *e = _load(buffer, bufferLen);
+      return _draw(e, x, y);
+    }
+
+    /**
+     * @brief Gets the decoded pixels of an image file, for example to draw into a canvas.
+     * @return Returns the image or nullptr if it could not be loaded or is larger than the budget.
+     * @param name The name of the image, a ".bmp" or ".png" file.
+     */
+    const image *get(const char *name)
+    {
+      _entry *e = _load(name);
+      return e != nullptr && e->cached ? &e->img : _discard(e);
+    }
+
+    /**
+     * @brief Gets the decoded pixels of an image held in a buffer.
+     * @return Returns the image or nullptr if it could not be decoded or is larger than the budget.
+     * @param buffer Pointer to the file contents.
+     * @param bufferLen The length of the buffer in bytes.
+     */
+    const image *get(const uint8_t *buffer, int bufferLen)
+    {
+      _entry *e = _load(buffer, bufferLen);
+      return e != nullptr && e->cached ? &e->img : _discard(e);
+    }
+
+    /**
+     * @brief Drops a file from the cache, call this when the file on the SD card changes.
+     * @param name The name of the image.
+     */
+    void remove(const char *name)
+    {
+      _entry *e = _find(_hash(name, strlen(name)), name);
+      if (e != nullptr)
+        _free(e);
+    }
+
+    /**
+     * @brief Drops every cached image.
+     */
+    void clear()
+    {
+      while (_head != nullptr)
+        _free(_head);
+    }
+
+    /**
+     * @brief Changes the budget, dropping images if needed.
+     * @param budget The maximum number of bytes of pixels to keep.
+     */
+    void setBudget(uint32_t budget)
+    {
+      _budget = budget;
+      _makeRoom(0);
+    }
+
+    uint32_t budget() const { return _budget; }
+    uint32_t used() const { return _used; }
+    uint32_t hits() const { return _hits; }
+    uint32_t misses() const { return _misses; }
+
+  private:
+    struct _entry
+    {
+      _entry *prev;
+      _entry *next;
+      uint32_t hash;
+      uint32_t bytes;
+      bool cached;
+      image img;
+      char name[1];
+    };
+
+    brain::lcd &_screen;
+    uint32_t _budget;
+    uint32_t _used;
+    uint32_t _hits;
+    uint32_t _misses;
+    _entry *_head; // most recently used
+    _entry *_tail; // least recently used
+
+    // FNV-1a
+    static uint32_t _hash(const void *p, uint32_t len)
+    {
+      const uint8_t *b = (const uint8_t *)p;
+      uint32_t h = 2166136261u;
+      for (uint32_t i = 0; i < len; i++)
+        h = (h ^ b[i]) * 16777619u;
+      return h;
+    }
+
+    void _unlink(_entry *e)
+    {
+      (e->prev ? e->prev->next : _head) = e->next;
+      (e->next ? e->next->prev : _tail) = e->prev;
+    }
+
+    void _pushFront(_entry *e)
+    {
+      e->prev = nullptr;
+      e->next = _head;
+      (_head ? _head->prev : _tail) = e;
+      _head = e;
+    }
+
+    void _free(_entry *e)
+    {
+      if (e->cached)
+      {
+        _unlink(e);
+        _used -= e->bytes;
+      }
+      free(e);
+    }
+
+    // entries that did not fit the budget are freed after use
+    const image *_discard(_entry *e)
+    {
+      if (e != nullptr)
+        free(e);
+      return nullptr;
+    }
+
+    void _makeRoom(uint32_t bytes)
+    {
+      while (_tail != nullptr && _used + bytes > _budget)
+        _free(_tail);
+    }
+
+    // name is nullptr for buffers
+    _entry *_find(uint32_t hash, const char *name)
+    {
+      for (_entry *e = _head; e != nullptr; e = e->next)
+      {
+        if (e->hash == hash && (name == nullptr ? e->name[0] == 0 : strcmp(e->name, name) == 0))
+        {
+          if (e != _head)
+          {
+            _unlink(e);
+            _pushFront(e);
+          }
+          return e;
+        }
+      }
+      return nullptr;
+    }
+
+    _entry *_load(const char *name)
+    {
+      if (name == nullptr)
+        return nullptr;
+
+      uint32_t hash = _hash(name, strlen(name));
+      _entry *e = _find(hash, name);
+      if (e != nullptr)
+      {
+        _hits++;
+        return e;
+      }
+
+      FIL *fp = vexFileOpen(name, "");
+      if (fp == nullptr)
+        return nullptr;
+
+      int32_t len = vexFileSize(fp);
+      uint8_t *buffer = len > 0 ? (uint8_t *)malloc(len) : nullptr;
+      if (buffer != nullptr && vexFileRead((char *)buffer, 1, len, fp) == len)
+        e = _decode(buffer, len, hash, name);
+      vexFileClose(fp);
+      free(buffer);
+
+      return e;
+    }
+
+    _entry *_load(const uint8_t *buffer, int bufferLen)
+    {
+      if (buffer == nullptr || bufferLen <= 0)
+        return nullptr;
+
+      uint32_t hash = _hash(buffer, bufferLen) ^ (uint32_t)bufferLen;
+      _entry *e = _find(hash, nullptr);
+      if (e != nullptr)
+      {
+        _hits++;
+        return e;
+      }
+
+      return _decode(buffer, bufferLen, hash, "");
+    }
+
+    _entry *_decode(const uint8_t *buffer, int32_t len, uint32_t hash, const char *name)
+    {
+      _misses++;
+
+      if (len < 8)
+        return nullptr;
+      bool bmp = buffer[0] == 'B' && buffer[1] == 'M';
+      bool png = buffer[0] == 0x89 && buffer[1] == 'P' && buffer[2] == 'N' && buffer[3] == 'G';
+      if (!bmp && !png)
+        return nullptr;
+
+      // decode into the scratch memory, then keep an exact size copy
+      void *scratch = nullptr;
+      if (vexScratchMemoryPtr(&scratch) < SYSTEM_DISPLAY_WIDTH * SYSTEM_DISPLAY_HEIGHT * 4 || scratch == nullptr)
+        return nullptr;
+      if (!vexScratchMemoryLock())
+        return nullptr;
+
+      v5_image img = {};
+      img.data = (uint32_t *)scratch;
+      uint32_t ok = bmp ? vexImageBmpRead(buffer, &img, SYSTEM_DISPLAY_WIDTH, SYSTEM_DISPLAY_HEIGHT)
+                        : vexImagePngRead(buffer, &img, SYSTEM_DISPLAY_WIDTH, SYSTEM_DISPLAY_HEIGHT, len);
+
+      _entry *e = nullptr;
+      if (ok != 0 && img.width > 0 && img.height > 0)
+      {
+        uint32_t bytes = (uint32_t)img.width * img.height * 4;
+        uint32_t nameLen = strlen(name);
+        uint32_t header = (sizeof(_entry) + nameLen + 3) & ~3u;
+
+        e = (_entry *)malloc(header + bytes);
+        if (e != nullptr)
+        {
+          e->hash = hash;
+          e->bytes = bytes;
+          e->img.data = (uint32_t *)((uint8_t *)e + header);
+          e->img.width = img.width;
+          e->img.height = img.height;
+          memcpy(e->name, name, nameLen + 1);
+          memcpy(e->img.data, img.data, bytes);
+        }
+      }
+      vexScratchMemoryUnlock();
+
+      if (e == nullptr)
+        return nullptr;
+
+      e->cached = e->bytes <= _budget;
+      if (e->cached)
+      {
+        _makeRoom(e->bytes);
+        _pushFront(e);
+        _used += e->bytes;
+      }
+      return e;
+    }
+
+    bool _draw(_entry *e, int x, int y)
+    {
+      if (e == nullptr)
+        return false;
+      bool ok = _screen.drawImageFromBuffer(e->img.data, x, y, e->img.width, e->img.height);
+      if (!e->cached)
+        free(e);
+      return ok;
+    }
+  };
+};
+
+#endif // VEX_IMAGECACHE_CLASS_H
@@ -0,0 +1,354 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_inputlog.h                                              */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_INPUTLOG_CLASS_H
+#define VEX_INPUTLOG_CLASS_H
+
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_inputlog.h
+ * @brief   Device input record and replay class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief input log class                                                     */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define INPUTLOG_MAX_CHANNELS 256
+
+  /**
+   * @brief Use the inputlog class to record what the devices and controller report and play it back later.
+   * @details
+   *  Build with INPUTLOG = 1 in the makefile.  That links vex/vex_inputlog.cpp
+   *  and has the linker route every function in INPUTLOG_FUNCTIONS, the
+   *  vexDevice*Get functions and vexControllerGet, through it, including the
+   *  calls made by the motor, inertial and other device classes.  While no
+   *  inputlog is recording or replaying, the wrappers only pass calls on.
+   *  record() writes a timestamped record through an sdlogger whenever a
+   *  function returns a different value for a device and argument than last
+   *  time, see vex_inputlogformat.h.
+   *  replay() returns the recorded values instead of asking the devices.  A
+   *  call gets the last value recorded at or before the same time since the
+   *  start of the recording, so changed control code still sees the inputs
+   *  of the recorded match as they were at that moment.  A value that was
+   *  never recorded comes from the device.  Commands sent to motors are not
+   *  simulated, replay reproduces what the code read, not how the robot
+   *  would have reacted to different outputs.
+   *  Replay runs on the brain.  The SDK has no host build of the V5 API or
+   *  of the device classes, so recordings cannot be replayed on a Linux
+   *  host, tools/host/inputdump prints them there.
+   *  Functions whose output length is not known from their arguments,
+   *  vexDeviceArmJointInfoGet, vexDeviceArmJointErrorsGet and
+   *  vexDeviceAiVisionClassNameGet, are not recorded.
+   *
+   * @code
+   *  inputlog inputs("match.inp");
+   *
+   *  void pre_auton() {
+   *    inputs.record();  // or inputs.replay() to play the match back
+   *  }
+   * @endcode
+   */
+  class inputlog
+  {
+  public:
+    /**
+     * @brief Creates a new input log, nothing is opened until record() or replay().
+     * @param name The name of the recording.
+     */
+    inputlog(const char *name) : _logger(name, false)
+    {
+      strncpy(_name, name != nullptr ? name : "input.inp", SDLOGGER_MAX_NAME - 1);
+      _name[SDLOGGER_MAX_NAME - 1] = 0;
+      _mode = _modeIdle;
+      _start = 0;
+      _prevTime = 0;
+      _records = 0;
+      _missed = 0;
+      _pending = false;
+      _clear();
+    }
+    ~inputlog() { stop(); };
+
+    inputlog(const inputlog &) = delete;
+    inputlog &operator=(const inputlog &) = delete;
+
+    /**
+     * @brief Starts recording, the file is replaced.
+     * @return Returns false if the file cannot be opened or another input log is in use.
+     */
+    bool record()
+    {
+      if (_active != nullptr || !_logger.start())
+        return false;
+      uint8_t header[5] = {(uint8_t)INPUTLOG_MAGIC, (uint8_t)(INPUTLOG_MAGIC >> 8), (uint8_t)(INPUTLOG_MAGIC >> 16),
+                           (uint8_t)(INPUTLOG_MAGIC >> 24), INPUTLOG_VERSION};
+      _logger.write(header, sizeof(header));
+      _begin(_modeRecord);
+      return true;
+    }
+
+    /**
+     * @brief Starts playing a recording back.
+     * @return Returns false if the recording cannot be read or another input log is in use.
+     */
+    bool replay()
+    {
+      if (_active != nullptr || !_reader.open(_name))
+        return false;
+      uint8_t header[5];
+      if (_reader.read(header, sizeof(header)) != sizeof(header) ||
+          (header[0] | (header[1] << 8) | (header[2] << 16) | ((uint32_t)header[3] << 24)) != INPUTLOG_MAGIC ||
+          header[4] != INPUTLOG_VERSION)
+      {
+        _reader.close();
+        return false;
+      }
+      _begin(_modeReplay);
+      return true;
+    }
+
+    /**
+     * @brief Stops recording or replaying, calls go to the devices again.
+     */
+    void stop()
+    {
+      if (_active == this)
+        _active = nullptr;
+      if (_mode == _modeRecord)
+        _logger.stop();
+      if (_mode == _modeReplay)
+        _reader.close();
+      _mode = _modeIdle;
+    }
+
+    bool recording() const { return _mode == _modeRecord; }
+    bool replaying() const { return _mode == _modeReplay; }
+
+    /**
+     * @brief Gets the time since record() or replay().
+     * @return Returns the time in uS, the time base of the recording.
+     */
+    uint64_t time() const { return vexSystemHighResTimeGet() - _start; }
+
+    uint32_t records() const { return _records; }
+    uint32_t missed() const { return _missed; }
+    uint32_t dropped() const { return _logger.dropped(); }
+
+    /**
+     * @brief Checks if any input log is recording or replaying, used by the wrappers in vex_inputlog.cpp.
+     */
+    static bool active() { return _active != nullptr; }
+
+    /**
+     * @brief Gets a recorded value while replaying, used by the wrappers in vex_inputlog.cpp.
+     * @return Returns true if value was set from the recording.
+     */
+    static bool replayed(uint32_t function, V5_DeviceT device, uint32_t argument, void *value, uint32_t len)
+    {
+      return _active != nullptr && _active->_mode == _modeReplay && _active->_get(function, _port(device), argument, value, len);
+    }
+
+    /**
+     * @brief Records a value returned by a device, used by the wrappers in vex_inputlog.cpp.
+     */
+    static void recorded(uint32_t function, V5_DeviceT device, uint32_t argument, const void *value, uint32_t len)
+    {
+      if (_active != nullptr && _active->_mode == _modeRecord)
+        _active->_put(function, _port(device), argument, value, len);
+    }
+
+    /**
+     * @brief Same as replayed() for functions that take a port index instead of a device.
+     */
+    static bool replayedPort(uint32_t function, uint32_t port, uint32_t argument, void *value, uint32_t len)
+    {
+      return _active != nullptr && _active->_mode == _modeReplay && _active->_get(function, port, argument, value, len);
+    }
+
+    /**
+     * @brief Same as recorded() for functions that take a port index instead of a device.
+     */
+    static void recordedPort(uint32_t function, uint32_t port, uint32_t argument, const void *value, uint32_t len)
+    {
+      if (_active != nullptr && _active->_mode == _modeRecord)
+        _active->_put(function, port, argument, value, len);
+    }
+
+  private:
+    enum _modes
+    {
+      _modeIdle = 0,
+      _modeRecord,
+      _modeReplay
+    };
+
+    struct _channel
+    {
+      uint64_t key;
+      uint8_t len;
+      uint8_t value[INPUTLOG_MAX_VALUE];
+    };
+
+    static inline inputlog *_active = nullptr;
+    static inline V5_DeviceT _handles[V5_MAX_DEVICE_PORTS] = {};
+
+    char _name[SDLOGGER_MAX_NAME];
+    sdlogger _logger;
+    filereader _reader;
+    _modes _mode;
+    uint64_t _start;
+    uint64_t _prevTime;
+    uint32_t _records;
+    uint32_t _missed;
+    _channel _channels[INPUTLOG_MAX_CHANNELS];
+    int32_t _count;
+    int16_t _index[INPUTLOG_MAX_CHANNELS * 2]; // open addressing, -1 is empty
+
+    // the next record while replaying, applied once its time is reached
+    bool _pending;
+    inputlogformat::record _next;
+    uint8_t _nextValue[INPUTLOG_MAX_VALUE];
+
+    static uint32_t _port(V5_DeviceT device)
+    {
+      for (uint32_t i = 0; i < V5_MAX_DEVICE_PORTS; i++)
+        if (_handles[i] == device)
+          return i;
+      return INPUTLOG_NO_PORT;
+    }
+
+    static uint64_t _key(uint32_t function, uint32_t port, uint32_t argument)
+    {
+      return ((uint64_t)function << 40) | ((uint64_t)(port & 0xFF) << 32) | argument;
+    }
+
+    void _begin(_modes mode)
+    {
+      for (uint32_t i = 0; i < V5_MAX_DEVICE_PORTS; i++)
+        _handles[i] = vexDeviceGetByIndex(i);
+      _clear();
+      _records = 0;
+      _missed = 0;
+      _pending = false;
+      _next.time = 0;
+      _prevTime = 0;
+      _start = vexSystemHighResTimeGet();
+      _mode = mode;
+      _active = this;
+    }
+
+    void _clear()
+    {
+      _count = 0;
+      for (int16_t &i : _index)
+        i = -1;
+    }
+
+    int32_t _find(uint64_t key, bool add)
+    {
+      uint32_t h = (uint32_t)(key ^ (key >> 29)) * 2654435761u;
+      for (uint32_t s = h >> 23;; s++)
+      {
+        int16_t &slot = _index[s % (INPUTLOG_MAX_CHANNELS * 2)];
+        if (slot >= 0 && _channels[slot].key == key)
+          return slot;
+        if (slot < 0)
+        {
+          if (!add || _count >= INPUTLOG_MAX_CHANNELS)
+            return -1;
+          _channels[_count].key = key;
+          _channels[_count].len = 0xFF;
+          slot = _count;
+          return _count++;
+        }
+      }
+    }
+
+    void _put(uint32_t function, uint32_t port, uint32_t argument, const void *value, uint32_t len)
+    {
+      if (len > INPUTLOG_MAX_VALUE)
+        return;
+      // only changes are recorded, a full table records every call
+      int32_t c = _find(_key(function, port, argument), true);
+      if (c >= 0 && _channels[c].len == len && memcmp(_channels[c].value, value, len) == 0)
+        return;
+
+      uint64_t now = time();
+      uint8_t buf[INPUTLOG_MAX_RECORD];
+      uint32_t n = inputlogformat::putVarint(buf, now - _prevTime);
+      buf[n++] = function;
+      buf[n++] = port;
+      n += inputlogformat::putVarint(buf + n, argument);
+      buf[n++] = len;
+      memcpy(buf + n, value, len);
+      n += len;
+      if (!_logger.write(buf, n))
+        return;
+
+      _prevTime = now;
+      _records++;
+      if (c >= 0)
+      {
+        _channels[c].len = len;
+        memcpy(_channels[c].value, value, len);
+      }
+    }
+
+    bool _get(uint32_t function, uint32_t port, uint32_t argument, void *value, uint32_t len)
+    {
+      _advance(time());
+      int32_t c = _find(_key(function, port, argument), false);
+      if (c < 0 || _channels[c].len != len)
+      {
+        _missed++;
+        return false;
+      }
+      memcpy(value, _channels[c].value, len);
+      return true;
+    }
+
+    // applies every record up to now
+    void _advance(uint64_t now)
+    {
+      while (true)
+      {
+        if (!_pending)
+        {
+          std::span<const uint8_t> s = _reader.peek(INPUTLOG_MAX_RECORD);
+          uint32_t n = inputlogformat::getRecord(s.data(), s.data() + s.size(), _next);
+          if (n == 0)
+            return;
+          memcpy(_nextValue, _next.value, _next.length);
+          _next.value = _nextValue;
+          _reader.skip(n);
+          _pending = true;
+        }
+        if (_next.time > now)
+          return;
+
+        int32_t c = _find(_key(_next.function, _next.port, _next.argument), true);
+        if (c >= 0)
+        {
+          _channels[c].len = _next.length;
+          memcpy(_channels[c].value, _next.value, _next.length);
+        }
+        _records++;
+        _pending = false;
+      }
+    }
+  };
+};
+
+#endif // VEX_INPUTLOG_CLASS_H
@@ -0,0 +1,258 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_inputlogformat.h                                        */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_INPUTLOGFORMAT_H
+#define VEX_INPUTLOGFORMAT_H
+
+#include <stdint.h>
+
+#include "vex_varint.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_inputlogformat.h
+ * @brief   Device input recording format
+ * @details
+ *  A recording starts with INPUTLOG_MAGIC and INPUTLOG_VERSION, then holds
+ *  one record each time a recorded function returns a value that differs
+ *  from the last one it returned for the same device and argument.
+ *
+ *    time       varint, uS since the previous record
+ *    function   uint8_t, the position in INPUTLOG_FUNCTIONS
+ *    port       uint8_t, the zero-based port index, or INPUTLOG_NO_PORT
+ *    argument   varint, an ADI port, object index, controller channel and
+ *               so on, 0 for functions without one
+ *    length     uint8_t, then that many bytes of value, the return value
+ *               first and then anything returned through pointers, in the
+ *               brain's byte order
+ *
+ *  INPUTLOG_FUNCTIONS lists every recorded function as
+ *  X(name, kind, return type, argument or output type).  Types are only
+ *  used by vex_inputlog.cpp, so host tools can include this header.  New
+ *  functions go at the end so older recordings keep their meaning.
+ *  The example makefile passes a --wrap option for each name to the linker.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace inputlogformat
+  {
+    using varint::putVarint;
+    using varint::getVarint;
+
+#define INPUTLOG_MAGIC 0x52493556 // "V5IR"
+#define INPUTLOG_VERSION 1
+#define INPUTLOG_NO_PORT 0xFF
+#define INPUTLOG_MAX_VALUE 80
+#define INPUTLOG_MAX_RECORD (10 + 2 + 5 + 1 + INPUTLOG_MAX_VALUE)
+
+// kinds of function
+// DEV     R name(V5_DeviceT)
+// ARG     R name(V5_DeviceT, T)
+// OUT     void name(V5_DeviceT, T *)
+// RETOUT  R name(V5_DeviceT, T *)
+// ARGOUT  R name(V5_DeviceT, uint32_t, T *)
+// SPECIAL written by hand in vex_inputlog.cpp
+#define INPUTLOG_FUNCTIONS(X)                                                      \
+  X(vexControllerGet, SPECIAL, int32_t, void)                                      \
+  X(vexDeviceGetStatus, SPECIAL, int32_t, void)                                    \
+  X(vexDeviceGetTimestamp, DEV, int32_t, void)                                     \
+  X(vexDeviceGetTimestampByIndex, SPECIAL, int32_t, void)                          \
+  X(vexDeviceButtonStateGet, SPECIAL, uint32_t, void)                              \
+  X(vexDevicesGetNumber, SPECIAL, uint32_t, void)                                  \
+  X(vexDevicesGetNumberByType, SPECIAL, uint32_t, void)                            \
+  X(vexDeviceLedGet, DEV, V5_DeviceLedColor, void)                                 \
+  X(vexDeviceLedRgbGet, DEV, uint32_t, void)                                       \
+  X(vexDeviceAdiPortConfigGet, ARG, V5_AdiPortConfiguration, uint32_t)             \
+  X(vexDeviceAdiValueGet, ARG, int32_t, uint32_t)                                  \
+  X(vexDeviceBumperGet, DEV, V5_DeviceBumperState, void)                           \
+  X(vexDeviceGyroHeadingGet, DEV, double, void)                                    \
+  X(vexDeviceGyroDegreesGet, DEV, double, void)                                    \
+  X(vexDeviceSonarValueGet, DEV, int32_t, void)                                    \
+  X(vexDeviceGenericValueGet, DEV, int32_t, void)                                  \
+  X(vexDeviceMotorVelocityGet, DEV, int32_t, void)                                 \
+  X(vexDeviceMotorActualVelocityGet, DEV, double, void)                            \
+  X(vexDeviceMotorDirectionGet, DEV, int32_t, void)                                \
+  X(vexDeviceMotorModeGet, DEV, V5MotorControlMode, void)                          \
+  X(vexDeviceMotorPwmGet, DEV, int32_t, void)                                      \
+  X(vexDeviceMotorCurrentLimitGet, DEV, int32_t, void)                             \
+  X(vexDeviceMotorVoltageLimitGet, DEV, int32_t, void)                             \
+  X(vexDeviceMotorCurrentGet, DEV, int32_t, void)                                  \
+  X(vexDeviceMotorVoltageGet, DEV, int32_t, void)                                  \
+  X(vexDeviceMotorPowerGet, DEV, double, void)                                     \
+  X(vexDeviceMotorTorqueGet, DEV, double, void)                                    \
+  X(vexDeviceMotorEfficiencyGet, DEV, double, void)                                \
+  X(vexDeviceMotorTemperatureGet, DEV, double, void)                               \
+  X(vexDeviceMotorOverTempFlagGet, DEV, bool, void)                                \
+  X(vexDeviceMotorCurrentLimitFlagGet, DEV, bool, void)                            \
+  X(vexDeviceMotorFaultsGet, DEV, uint32_t, void)                                  \
+  X(vexDeviceMotorZeroVelocityFlagGet, DEV, bool, void)                            \
+  X(vexDeviceMotorZeroPositionFlagGet, DEV, bool, void)                            \
+  X(vexDeviceMotorFlagsGet, DEV, uint32_t, void)                                   \
+  X(vexDeviceMotorReverseFlagGet, DEV, bool, void)                                 \
+  X(vexDeviceMotorEncoderUnitsGet, DEV, V5MotorEncoderUnits, void)                 \
+  X(vexDeviceMotorBrakeModeGet, DEV, V5MotorBrakeMode, void)                       \
+  X(vexDeviceMotorPositionGet, DEV, double, void)                                  \
+  X(vexDeviceMotorPositionRawGet, RETOUT, int32_t, uint32_t)                       \
+  X(vexDeviceMotorTargetGet, DEV, double, void)                                    \
+  X(vexDeviceMotorGearingGet, DEV, V5MotorGearset, void)                           \
+  X(vexDeviceVisionModeGet, DEV, V5VisionMode, void)                               \
+  X(vexDeviceVisionObjectCountGet, DEV, int32_t, void)                             \
+  X(vexDeviceVisionObjectGet, ARGOUT, int32_t, V5_DeviceVisionObject)              \
+  X(vexDeviceVisionSignatureGet, ARGOUT, bool, V5_DeviceVisionSignature)           \
+  X(vexDeviceVisionBrightnessGet, DEV, uint8_t, void)                              \
+  X(vexDeviceVisionWhiteBalanceModeGet, DEV, V5VisionWBMode, void)                 \
+  X(vexDeviceVisionWhiteBalanceGet, DEV, V5_DeviceVisionRgb, void)                 \
+  X(vexDeviceVisionLedModeGet, DEV, V5VisionLedMode, void)                         \
+  X(vexDeviceVisionLedBrigntnessGet, DEV, uint8_t, void)                           \
+  X(vexDeviceVisionLedColorGet, DEV, V5_DeviceVisionRgb, void)                     \
+  X(vexDeviceVisionWifiModeGet, DEV, V5VisionWifiMode, void)                       \
+  X(vexDeviceImuHeadingGet, DEV, double, void)                                     \
+  X(vexDeviceImuDegreesGet, DEV, double, void)                                     \
+  X(vexDeviceImuQuaternionGet, OUT, void, V5_DeviceImuQuaternion)                  \
+  X(vexDeviceImuAttitudeGet, OUT, void, V5_DeviceImuAttitude)                      \
+  X(vexDeviceImuRawGyroGet, OUT, void, V5_DeviceImuRaw)                            \
+  X(vexDeviceImuRawAccelGet, OUT, void, V5_DeviceImuRaw)                           \
+  X(vexDeviceImuStatusGet, DEV, uint32_t, void)                                    \
+  X(vexDeviceImuModeGet, DEV, uint32_t, void)                                      \
+  X(vexDeviceRangeValueGet, DEV, int32_t, void)                                    \
+  X(vexDeviceAbsEncPositionGet, DEV, int32_t, void)                                \
+  X(vexDeviceAbsEncVelocityGet, DEV, int32_t, void)                                \
+  X(vexDeviceAbsEncAngleGet, DEV, int32_t, void)                                   \
+  X(vexDeviceAbsEncReverseFlagGet, DEV, bool, void)                                \
+  X(vexDeviceAbsEncStatusGet, DEV, uint32_t, void)                                 \
+  X(vexDeviceOpticalHueGet, DEV, double, void)                                     \
+  X(vexDeviceOpticalSatGet, DEV, double, void)                                     \
+  X(vexDeviceOpticalBrightnessGet, DEV, double, void)                              \
+  X(vexDeviceOpticalProximityGet, DEV, int32_t, void)                              \
+  X(vexDeviceOpticalRgbGet, OUT, void, V5_DeviceOpticalRgb)                        \
+  X(vexDeviceOpticalLedPwmGet, DEV, int32_t, void)                                 \
+  X(vexDeviceOpticalStatusGet, DEV, uint32_t, void)                                \
+  X(vexDeviceOpticalRawGet, OUT, void, V5_DeviceOpticalRaw)                        \
+  X(vexDeviceOpticalModeGet, DEV, uint32_t, void)                                  \
+  X(vexDeviceOpticalGestureGet, RETOUT, uint32_t, V5_DeviceOpticalGesture)         \
+  X(vexDeviceOpticalIntegrationTimeGet, DEV, double, void)                         \
+  X(vexDeviceMagnetPowerGet, DEV, int32_t, void)                                   \
+  X(vexDeviceMagnetTemperatureGet, DEV, double, void)                              \
+  X(vexDeviceMagnetCurrentGet, DEV, double, void)                                  \
+  X(vexDeviceMagnetStatusGet, DEV, uint32_t, void)                                 \
+  X(vexDeviceLightTowerRgbGet, DEV, uint32_t, void)                                \
+  X(vexDeviceLightTowerXywGet, DEV, uint32_t, void)                                \
+  X(vexDeviceLightTowerStatusGet, DEV, uint32_t, void)                             \
+  X(vexDeviceLightTowerDebugGet, ARG, uint32_t, int32_t)                           \
+  X(vexDeviceDistanceDistanceGet, DEV, uint32_t, void)                             \
+  X(vexDeviceDistanceConfidenceGet, DEV, uint32_t, void)                           \
+  X(vexDeviceDistanceObjectSizeGet, DEV, int32_t, void)                            \
+  X(vexDeviceDistanceObjectVelocityGet, DEV, double, void)                         \
+  X(vexDeviceDistanceStatusGet, DEV, uint32_t, void)                               \
+  X(vexDeviceGpsHeadingGet, DEV, double, void)                                     \
+  X(vexDeviceGpsDegreesGet, DEV, double, void)                                     \
+  X(vexDeviceGpsQuaternionGet, OUT, void, V5_DeviceGpsQuaternion)                  \
+  X(vexDeviceGpsAttitudeGet, SPECIAL, void, V5_DeviceGpsAttitude)                  \
+  X(vexDeviceGpsRawGyroGet, OUT, void, V5_DeviceGpsRaw)                            \
+  X(vexDeviceGpsRawAccelGet, OUT, void, V5_DeviceGpsRaw)                           \
+  X(vexDeviceGpsStatusGet, DEV, uint32_t, void)                                    \
+  X(vexDeviceGpsModeGet, DEV, uint32_t, void)                                      \
+  X(vexDeviceGpsOriginGet, SPECIAL, void, void)                                    \
+  X(vexDeviceGpsRotationGet, DEV, double, void)                                    \
+  X(vexDeviceGpsErrorGet, DEV, double, void)                                       \
+  X(vexDeviceAiVisionModeGet, DEV, uint32_t, void)                                 \
+  X(vexDeviceAiVisionObjectCountGet, DEV, int32_t, void)                           \
+  X(vexDeviceAiVisionObjectGet, ARGOUT, int32_t, V5_DeviceAiVisionObject)          \
+  X(vexDeviceAiVisionColorGet, ARGOUT, bool, V5_DeviceAiVisionColor)               \
+  X(vexDeviceAiVisionCodeGet, ARGOUT, bool, V5_DeviceAiVisionCode)                 \
+  X(vexDeviceAiVisionStatusGet, DEV, uint32_t, void)                               \
+  X(vexDeviceAiVisionTemperatureGet, DEV, double, void)                            \
+  X(vexDevicePneumaticStatusGet, DEV, uint32_t, void)                              \
+  X(vexDevicePneumaticPwmGet, DEV, uint32_t, void)                                 \
+  X(vexDevicePneumaticActuationStatusGet, SPECIAL, uint32_t, void)                 \
+  X(vexDeviceArmTipPositionGet, SPECIAL, void, void)                               \
+  X(vexDeviceArmJ6PositionGet, DEV, double, void)                                  \
+  X(vexDeviceArmBatteryGet, DEV, int32_t, void)                                    \
+  X(vexDeviceArmServoFlagsGet, ARG, int32_t, uint32_t)                             \
+  X(vexDeviceArmStatusGet, DEV, uint32_t, void)                                    \
+  X(vexDeviceArmDebugGet, ARG, uint32_t, int32_t)                                  \
+  X(vexDeviceArmTipPositionGetAdv, OUT, void, V5_DeviceArmTipPosition)             \
+  X(vexDeviceGenericRadioLinkStatus, DEV, bool, void)
+
+#define INPUTLOG_ENUM(name, kind, R, T) kInputFunction_##name,
+
+    enum tInputFunction
+    {
+      INPUTLOG_FUNCTIONS(INPUTLOG_ENUM)
+          kInputFunctionCount
+    };
+
+    /**
+     * @brief Gets the name of a recorded function.
+     * @return Returns the name, or nullptr for an unknown function.
+     */
+    inline const char *functionName(uint32_t function)
+    {
+#define INPUTLOG_NAME(name, kind, R, T) #name,
+      static const char *const names[] = {INPUTLOG_FUNCTIONS(INPUTLOG_NAME)};
+#undef INPUTLOG_NAME
+      return function < kInputFunctionCount ? names[function] : nullptr;
+    }
+
+    /**
+     * @brief Gets the return type of a recorded function as written in v5_api.h.
+     * @return Returns the type, or nullptr for an unknown function.
+     */
+    inline const char *functionType(uint32_t function)
+    {
+#define INPUTLOG_TYPE(name, kind, R, T) #R,
+      static const char *const types[] = {INPUTLOG_FUNCTIONS(INPUTLOG_TYPE)};
+#undef INPUTLOG_TYPE
+      return function < kInputFunctionCount ? types[function] : nullptr;
+    }
+
+    struct record
+    {
+      uint64_t time; // uS since the start of the recording
+      uint8_t function;
+      uint8_t port;
+      uint32_t argument;
+      uint8_t length;
+      const uint8_t *value;
+    };
+
+    /**
+     * @brief Reads one record.
+     * @return Returns the number of bytes used, or 0 if the input ends first or is not valid.
+     * @param p The input.
+     * @param end The end of the input.
+     * @param r The record, its time is advanced from the previous record.
+     */
+    inline uint32_t getRecord(const uint8_t *p, const uint8_t *end, record &r)
+    {
+      const uint8_t *start = p;
+      uint64_t dt, arg;
+      if (!getVarint(p, end, dt) || end - p < 2)
+        return 0;
+      uint8_t function = *p++;
+      uint8_t port = *p++;
+      if (!getVarint(p, end, arg) || p >= end || *p > INPUTLOG_MAX_VALUE || end - p < 1 + *p)
+        return 0;
+      if (function >= kInputFunctionCount || arg > 0xFFFFFFFF)
+        return 0;
+      r.time += dt;
+      r.function = function;
+      r.port = port;
+      r.argument = (uint32_t)arg;
+      r.length = *p;
+      r.value = p + 1;
+      return (p + 1 + r.length) - start;
+    }
+  };
+};
+
+#endif // VEX_INPUTLOGFORMAT_H
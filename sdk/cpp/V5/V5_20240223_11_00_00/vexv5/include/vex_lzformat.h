@@ -0,0 +1,260 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_lzformat.h                                              */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_LZFORMAT_H
+#define VEX_LZFORMAT_H
+
+#include <stdint.h>
+
+#include "vex_crc.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_lzformat.h
+ * @brief   Block compression for logs
+ * @details
+ *  A compressed file is a sequence of independent blocks, each one a
+ *  LZ_HEADER_SIZE byte header followed by its data.
+ *
+ *    magic      uint32_t LZ_MAGIC
+ *    size       uint32_t, the uncompressed size, at most LZ_MAX_BLOCK
+ *    packed     uint32_t, the size of the data that follows, LZ_STORED is
+ *               set when the data is not compressed
+ *    crc        uint32_t, the vex_crc.h CRC32 of the uncompressed data
+ *
+ *  Compressed data uses the LZ4 block format, so lz4.block.decompress in
+ *  python reads it as well.  The compressor is the greedy single probe
+ *  kind, it favours speed over ratio and needs a LZ_TABLE_SIZE entry hash
+ *  table as its only memory.  Blocks that do not get smaller are stored.
+ *  A damaged block only loses itself, a reader rejects it when its
+ *  data does not match the CRC and finds the next one by its magic number.
+ *  All values are little endian.  tools/host/unlz.cpp reads files with it.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace lzformat
+  {
+#define LZ_MAGIC 0x5A4C3556 // "V5LZ"
+#define LZ_HEADER_SIZE 16
+#define LZ_STORED 0x80000000
+#define LZ_MAX_BLOCK 0xFFFF
+#define LZ_HASH_BITS 12
+#define LZ_TABLE_SIZE (1 << LZ_HASH_BITS)
+
+// LZ4 block format limits
+#define LZ_MIN_MATCH 4
+#define LZ_LAST_LITERALS 5
+#define LZ_MATCH_LIMIT 12
+
+    inline uint32_t _read32(const uint8_t *p)
+    {
+      uint32_t v;
+      __builtin_memcpy(&v, p, 4);
+      return v;
+    }
+
+    inline uint32_t _hash(uint32_t v)
+    {
+      return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+    }
+
+    inline uint32_t _putLength(uint8_t *p, uint32_t len)
+    {
+      uint32_t n = 0;
+      for (; len >= 255; len -= 255)
+        p[n++] = 255;
+      p[n++] = len;
+      return n;
+    }
+
+    /**
+     * @brief Writes a block header.
+     * @param p The output, LZ_HEADER_SIZE bytes.
+     * @param size The uncompressed size.
+     * @param packed The size of the data that follows.
+     * @param stored Set to true if the data is not compressed.
+     * @param crc The CRC32 of the uncompressed data.
+     */
+    inline void putHeader(uint8_t *p, uint32_t size, uint32_t packed, bool stored, uint32_t crc)
+    {
+      uint32_t v[4] = {LZ_MAGIC, size, packed | (stored ? LZ_STORED : 0), crc};
+      for (int32_t i = 0; i < LZ_HEADER_SIZE; i++)
+        p[i] = v[i / 4] >> (8 * (i % 4));
+    }
+
+    /**
+     * @brief Reads a block header.
+     * @return Returns false if this is not a valid header.
+     * @param p The input, LZ_HEADER_SIZE bytes.
+     * @param size The uncompressed size.
+     * @param packed The size of the data that follows.
+     * @param stored Set to true if the data is not compressed.
+     * @param crc The CRC32 of the uncompressed data, check it once the block is decompressed.
+     */
+    inline bool getHeader(const uint8_t *p, uint32_t &size, uint32_t &packed, bool &stored, uint32_t &crc)
+    {
+      uint32_t v[4];
+      for (int32_t i = 0; i < 4; i++)
+        v[i] = p[i * 4] | (p[i * 4 + 1] << 8) | (p[i * 4 + 2] << 16) | ((uint32_t)p[i * 4 + 3] << 24);
+      size = v[1];
+      packed = v[2] & ~LZ_STORED;
+      stored = (v[2] & LZ_STORED) != 0;
+      crc = v[3];
+      return v[0] == LZ_MAGIC && size <= LZ_MAX_BLOCK && (stored ? packed == size : packed < size);
+    }
+
+    /**
+     * @brief Compresses one block.
+     * @return Returns the compressed size, or 0 if it would be larger than cap.
+     * @param src The data.
+     * @param len The length of the data, at most LZ_MAX_BLOCK.
+     * @param dst The output.
+     * @param cap The size of the output, use len - 1 to only keep blocks that get smaller.
+     * @param table A LZ_TABLE_SIZE entry hash table, its contents are not needed between calls.
+     */
+    inline uint32_t compress(const uint8_t *src, uint32_t len, uint8_t *dst, uint32_t cap, uint16_t *table)
+    {
+      if (len == 0 || len > LZ_MAX_BLOCK)
+        return 0;
+
+      uint32_t anchor = 0;
+      uint32_t o = 0;
+      if (len > LZ_MATCH_LIMIT)
+      {
+        __builtin_memset(table, 0, LZ_TABLE_SIZE * sizeof(uint16_t));
+        uint32_t limit = len - LZ_MATCH_LIMIT;
+        uint32_t matchEnd = len - LZ_LAST_LITERALS;
+        uint32_t i = 1;
+
+        while (i < limit)
+        {
+          uint32_t seq = _read32(src + i);
+          uint32_t h = _hash(seq);
+          uint32_t ref = table[h];
+          table[h] = i;
+          if (_read32(src + ref) != seq || ref >= i)
+          {
+            // step faster through data that does not compress
+            i += 1 + ((i - anchor) >> 6);
+            continue;
+          }
+
+          while (i > anchor && ref > 0 && src[i - 1] == src[ref - 1])
+          {
+            i--;
+            ref--;
+          }
+          uint32_t m = i + LZ_MIN_MATCH;
+          while (m < matchEnd && src[m] == src[ref + m - i])
+            m++;
+
+          uint32_t lit = i - anchor;
+          uint32_t match = m - i - LZ_MIN_MATCH;
+          if (o + 1 + lit / 255 + 1 + lit + 2 + match / 255 + 1 > cap)
+            return 0;
+
+          uint8_t *token = dst + o++;
+          *token = (lit < 15 ? lit : 15) << 4 | (match < 15 ? match : 15);
+          if (lit >= 15)
+            o += _putLength(dst + o, lit - 15);
+          __builtin_memcpy(dst + o, src + anchor, lit);
+          o += lit;
+          dst[o++] = (uint8_t)(i - ref);
+          dst[o++] = (uint8_t)((i - ref) >> 8);
+          if (match >= 15)
+            o += _putLength(dst + o, match - 15);
+
+          anchor = i = m;
+          if (i < limit)
+            table[_hash(_read32(src + i - 2))] = i - 2;
+        }
+      }
+
+      uint32_t lit = len - anchor;
+      if (o + 1 + lit / 255 + 1 + lit > cap)
+        return 0;
+      dst[o++] = (lit < 15 ? lit : 15) << 4;
+      if (lit >= 15)
+        o += _putLength(dst + o, lit - 15);
+      __builtin_memcpy(dst + o, src + anchor, lit);
+      return o + lit;
+    }
+
+    /**
+     * @brief Decompresses one block.
+     * @return Returns the uncompressed size, or -1 if the data is damaged or does not fit.
+     * @param src The compressed data.
+     * @param len The length of the compressed data.
+     * @param dst The output.
+     * @param cap The size of the output.
+     */
+    inline int32_t decompress(const uint8_t *src, uint32_t len, uint8_t *dst, uint32_t cap)
+    {
+      uint32_t i = 0;
+      uint32_t o = 0;
+      while (i < len)
+      {
+        uint8_t token = src[i++];
+        uint32_t lit = token >> 4;
+        if (lit == 15)
+        {
+          uint8_t b;
+          do
+          {
+            if (i >= len)
+              return -1;
+            b = src[i++];
+            lit += b;
+          } while (b == 255);
+        }
+        if (lit > len - i || lit > cap - o)
+          return -1;
+        __builtin_memcpy(dst + o, src + i, lit);
+        i += lit;
+        o += lit;
+        if (i == len)
+          return o;
+
+        if (len - i < 2)
+          return -1;
+        uint32_t offset = src[i] | (src[i + 1] << 8);
+        i += 2;
+        if (offset == 0 || offset > o)
+          return -1;
+        uint32_t match = token & 15;
+        if (match == 15)
+        {
+          uint8_t b;
+          do
+          {
+            if (i >= len)
+              return -1;
+            b = src[i++];
+            match += b;
+          } while (b == 255);
+        }
+        match += LZ_MIN_MATCH;
+        if (match > cap - o)
+          return -1;
+
+        // byte by byte, the match may overlap the bytes it produces
+        const uint8_t *ref = dst + o - offset;
+        for (uint32_t k = 0; k < match; k++)
+          dst[o + k] = ref[k];
+        o += match;
+      }
+      return -1;
+    }
+  };
+};
+
+#endif // VEX_LZFORMAT_H
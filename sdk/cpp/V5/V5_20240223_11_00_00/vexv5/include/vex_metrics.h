@@ -0,0 +1,460 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_metrics.h                                               */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_METRICS_CLASS_H
+#define VEX_METRICS_CLASS_H
+
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_metrics.h
+ * @brief   Histogram and counter metrics class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief metrics classes                                                     */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define METRICS_SUB_BITS 5  // 32 buckets per power of two, within 3.2%
+#define METRICS_MAX_BITS 26 // values up to 2^26, larger ones share the last bucket
+#define METRICS_BUCKETS ((METRICS_MAX_BITS - METRICS_SUB_BITS + 1) << METRICS_SUB_BITS)
+#define METRICS_MAX_NAME 23
+#define METRICS_MAX_LINE 128
+
+  /**
+   * @brief A metric as it was when metrics::summary was called.
+   */
+  struct metricsummary
+  {
+    const char *name;
+    bool histogram;
+    uint32_t count; // values recorded, or the value of a counter
+    uint32_t min;
+    uint32_t max;
+    double mean;
+    uint32_t p50;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t p999;
+  };
+
+  /**
+   * @brief The name and registration shared by histograms and counters.
+   * @details
+   *  Every metric adds itself to one list when it is created, metrics reads
+   *  them all from there.  Nothing is allocated.
+   */
+  class metric
+  {
+  public:
+    const char *name() const { return _name; }
+    bool isHistogram() const { return _histogram; }
+
+    /**
+     * @brief Gets the first metric, in the order they were created.
+     */
+    static metric *first() { return _first; }
+
+    /**
+     * @brief Gets the next metric.
+     * @return Returns nullptr after the last metric.
+     */
+    metric *next() const { return _next; }
+
+    /**
+     * @brief Finds a metric by name.
+     * @return Returns nullptr if there is no metric with that name.
+     */
+    static metric *find(const char *name)
+    {
+      for (metric *m = _first; m != nullptr; m = m->_next)
+        if (strcmp(m->_name, name) == 0)
+          return m;
+      return nullptr;
+    }
+
+    metric(const metric &) = delete;
+    metric &operator=(const metric &) = delete;
+
+  protected:
+    metric(const char *name, bool histogram) : _histogram(histogram)
+    {
+      strncpy(_name, name != nullptr ? name : "", METRICS_MAX_NAME);
+      _name[METRICS_MAX_NAME] = 0;
+      _next = nullptr;
+      metric **p = &_first;
+      while (*p != nullptr)
+        p = &(*p)->_next;
+      *p = this;
+    }
+    ~metric()
+    {
+      for (metric **p = &_first; *p != nullptr; p = &(*p)->_next)
+      {
+        if (*p == this)
+        {
+          *p = _next;
+          break;
+        }
+      }
+    };
+
+  private:
+    static inline metric *_first = nullptr;
+    metric *_next;
+    char _name[METRICS_MAX_NAME + 1];
+    bool _histogram;
+  };
+
+  /**
+   * @brief Use the histogram class to see how a time or other value is spread, not just its average.
+   * @details
+   *  Values are counted in log linear buckets like an HDR histogram, 32 per
+   *  power of two, so any percentile is within about 3% of the real value
+   *  from 1 to METRICS_MAX_BITS bits, and exact below 32.  record() is a
+   *  count leading zeros, a shift and a few adds, cheap enough for every
+   *  loop iteration and every device read.  A histogram takes about 2.8 kB.
+   *  Neither record() nor the readers yield, so a histogram can be recorded
+   *  from one task and read from another without a lock.
+   *  Times are in uS.  tick() records the time between calls, the period of
+   *  a loop, its p99 minus its p50 is the jitter.  A scope records the time
+   *  until it is left.
+   *
+   * @code
+   *  histogram drivePeriod("drive.period");
+   *  histogram driveTime("drive.time");
+   *
+   *  int driveTask() {
+   *    while (true) {
+   *      drivePeriod.tick();
+   *      {
+   *        histogram::scope t(driveTime);
+   *        ...
+   *      }
+   *      task::sleep(10);
+   *    }
+   *  }
+   * @endcode
+   */
+  class histogram : public metric
+  {
+  public:
+    /**
+     * @brief Creates a new empty histogram.
+     * @param name The name shown in summaries, at most METRICS_MAX_NAME characters are kept.
+     */
+    histogram(const char *name) : metric(name, true)
+    {
+      reset();
+    }
+    ~histogram() {};
+
+    /**
+     * @brief Counts a value.
+     * @param value The value, usually a time in uS.
+     */
+    void record(uint32_t value)
+    {
+      _counts[_index(value)]++;
+      _count++;
+      _sum += value;
+      if (value < _min)
+        _min = value;
+      if (value > _max)
+        _max = value;
+    }
+
+    /**
+     * @brief Counts the time since a start time.
+     * @param start A time from vexSystemHighResTimeGet.
+     */
+    void recordSince(uint64_t start)
+    {
+      uint64_t t = vexSystemHighResTimeGet() - start;
+      record(t > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)t);
+    }
+
+    /**
+     * @brief Counts the time since the last call, call once per loop iteration.
+     */
+    void tick()
+    {
+      uint64_t now = vexSystemHighResTimeGet();
+      if (_last != 0)
+        record(now - _last > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)(now - _last));
+      _last = now;
+    }
+
+    /**
+     * @brief Clears every count.
+     */
+    void reset()
+    {
+      memset(_counts, 0, sizeof(_counts));
+      _count = 0;
+      _sum = 0;
+      _min = 0xFFFFFFFF;
+      _max = 0;
+      _last = 0;
+    }
+
+    uint32_t count() const { return _count; }
+    uint32_t min() const { return _count > 0 ? _min : 0; }
+    uint32_t max() const { return _max; }
+    double mean() const { return _count > 0 ? (double)_sum / _count : 0; }
+
+    /**
+     * @brief Gets a percentile.
+     * @return Returns the largest value in the bucket holding that share of the values, 0 if there are none.
+     * @param q The share of values at or below the result, 0.99 for p99.
+     */
+    uint32_t percentile(double q) const
+    {
+      uint32_t v;
+      percentiles(&q, &v, 1);
+      return v;
+    }
+
+    /**
+     * @brief Gets several percentiles in one pass over the buckets.
+     * @param q The shares, in increasing order.
+     * @param values The percentiles.
+     * @param n The number of percentiles.
+     */
+    void percentiles(const double *q, uint32_t *values, int32_t n) const
+    {
+      int32_t k = 0;
+      uint32_t seen = 0;
+      for (int32_t i = 0; i < METRICS_BUCKETS && k < n && _count > 0; i++)
+      {
+        seen += _counts[i];
+        while (k < n && seen >= _rank(q[k]))
+        {
+          uint32_t v = _upper(i);
+          values[k++] = v < _min ? _min : v > _max ? _max : v;
+        }
+      }
+      for (; k < n; k++)
+        values[k] = _max;
+    }
+
+    /**
+     * @brief Records the time from its creation until it is destroyed into a histogram.
+     */
+    class scope
+    {
+    public:
+      scope(histogram &h) : _h(h) { _start = vexSystemHighResTimeGet(); }
+      ~scope() { _h.recordSince(_start); };
+
+      scope(const scope &) = delete;
+      scope &operator=(const scope &) = delete;
+
+    private:
+      histogram &_h;
+      uint64_t _start;
+    };
+
+  private:
+    uint32_t _counts[METRICS_BUCKETS];
+    uint32_t _count;
+    uint64_t _sum;
+    uint32_t _min;
+    uint32_t _max;
+    uint64_t _last;
+
+    // values below 2^METRICS_SUB_BITS have a bucket each, above that every
+    // power of two is split into 2^METRICS_SUB_BITS buckets
+    static uint32_t _index(uint32_t value)
+    {
+      if (value < (1u << METRICS_SUB_BITS))
+        return value;
+      uint32_t top = 31 - __builtin_clz(value);
+      if (top >= METRICS_MAX_BITS)
+        return METRICS_BUCKETS - 1;
+      uint32_t shift = top - METRICS_SUB_BITS;
+      return ((shift + 1) << METRICS_SUB_BITS) + (value >> shift) - (1u << METRICS_SUB_BITS);
+    }
+
+    static uint32_t _upper(uint32_t index)
+    {
+      if (index < (1u << METRICS_SUB_BITS))
+        return index;
+      if (index == METRICS_BUCKETS - 1)
+        return 0xFFFFFFFF;
+      uint32_t shift = (index >> METRICS_SUB_BITS) - 1;
+      uint32_t sub = index & ((1u << METRICS_SUB_BITS) - 1);
+      return (((1u << METRICS_SUB_BITS) + sub + 1) << shift) - 1;
+    }
+
+    uint32_t _rank(double q) const
+    {
+      if (q >= 1)
+        return _count;
+      double r = q * _count;
+      uint32_t rank = (uint32_t)r;
+      if (rank < r)
+        rank++;
+      return rank < 1 ? 1 : rank;
+    }
+  };
+
+  /**
+   * @brief Use the counter class to count events, such as retries or dropped packets.
+   */
+  class counter : public metric
+  {
+  public:
+    /**
+     * @brief Creates a new counter at 0.
+     * @param name The name shown in summaries, at most METRICS_MAX_NAME characters are kept.
+     */
+    counter(const char *name) : metric(name, false)
+    {
+      _value = 0;
+    }
+    ~counter() {};
+
+    void add(uint32_t n = 1) { _value += n; }
+    void reset() { _value = 0; }
+    uint32_t value() const { return _value; }
+
+  private:
+    uint32_t _value;
+  };
+
+  /**
+   * @brief Use the metrics class to read every histogram and counter at once.
+   * @details
+   *  summary() takes the numbers of one metric, format() makes a line of text
+   *  from them for the screen, print() writes every metric to the serial
+   *  port and log() to an sdlogger as CSV rows of
+   *  time in mS, name, count, min, p50, p90, p99, p99.9, max and mean.
+   *  With reset each report covers the time since the last one.
+   *
+   * @code
+   *  for (metric *m = metric::first(); m != nullptr; m = m->next()) {
+   *    metricsummary s;
+   *    char line[METRICS_MAX_LINE];
+   *    metrics::summary(*m, s);
+   *    metrics::format(s, line, sizeof(line));
+   *    Brain.Screen.printAt(10, y += 20, "%s", line);
+   *  }
+   * @endcode
+   */
+  class metrics
+  {
+  public:
+    /**
+     * @brief Takes the numbers of a metric.
+     * @param m The metric.
+     * @param s The summary.
+     */
+    static void summary(const metric &m, metricsummary &s)
+    {
+      memset(&s, 0, sizeof(s));
+      s.name = m.name();
+      s.histogram = m.isHistogram();
+      if (!s.histogram)
+      {
+        s.count = static_cast<const counter &>(m).value();
+        return;
+      }
+      const histogram &h = static_cast<const histogram &>(m);
+      static const double q[4] = {0.5, 0.9, 0.99, 0.999};
+      uint32_t p[4];
+      h.percentiles(q, p, 4);
+      s.count = h.count();
+      s.min = h.min();
+      s.max = h.max();
+      s.mean = h.mean();
+      s.p50 = p[0];
+      s.p90 = p[1];
+      s.p99 = p[2];
+      s.p999 = p[3];
+    }
+
+    /**
+     * @brief Makes a line of text from a summary.
+     * @return Returns the length of the line.
+     * @param s The summary.
+     * @param buf The line.
+     * @param len The size of buf, METRICS_MAX_LINE is always enough.
+     */
+    static int32_t format(const metricsummary &s, char *buf, uint32_t len)
+    {
+      if (!s.histogram)
+        return vex_snprintf(buf, len, "%s %lu", s.name, (unsigned long)s.count);
+      return vex_snprintf(buf, len, "%s n=%lu p50=%lu p99=%lu p99.9=%lu max=%lu", s.name, (unsigned long)s.count,
+                          (unsigned long)s.p50, (unsigned long)s.p99, (unsigned long)s.p999, (unsigned long)s.max);
+    }
+
+    /**
+     * @brief Writes every metric to the serial port, one line each.
+     * @param reset Set to true to clear the metrics afterwards.
+     */
+    static void print(bool reset = false)
+    {
+      char line[METRICS_MAX_LINE];
+      metricsummary s;
+      for (metric *m = metric::first(); m != nullptr; m = m->next())
+      {
+        summary(*m, s);
+        format(s, line, sizeof(line));
+        vex_printf("%s\n", line);
+      }
+      if (reset)
+        metrics::reset();
+    }
+
+    /**
+     * @brief Writes every metric to a log as a CSV row.
+     * @return Returns false if the log dropped a row.
+     * @param log The log.
+     * @param reset Set to true to clear the metrics afterwards.
+     */
+    static bool log(sdlogger &log, bool reset = false)
+    {
+      bool ok = true;
+      uint32_t now = vexSystemTimeGet();
+      metricsummary s;
+      for (metric *m = metric::first(); m != nullptr; m = m->next())
+      {
+        summary(*m, s);
+        ok = log.printf("%lu,%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%.1f\n", (unsigned long)now, s.name,
+                        (unsigned long)s.count, (unsigned long)s.min, (unsigned long)s.p50, (unsigned long)s.p90,
+                        (unsigned long)s.p99, (unsigned long)s.p999, (unsigned long)s.max, s.mean) &&
+             ok;
+      }
+      if (reset)
+        metrics::reset();
+      return ok;
+    }
+
+    /**
+     * @brief Clears every metric.
+     */
+    static void reset()
+    {
+      for (metric *m = metric::first(); m != nullptr; m = m->next())
+      {
+        if (m->isHistogram())
+          static_cast<histogram *>(m)->reset();
+        else
+          static_cast<counter *>(m)->reset();
+      }
+    }
+  };
+};
+
+#endif // VEX_METRICS_CLASS_H
@@ -0,0 +1,272 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_pixel.h                                                 */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_PIXEL_H
+#define VEX_PIXEL_H
+
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_pixel.h
+ * @brief   Pixel kernels for 32 bit 0x00RRGGBB frame buffers
+ * @details
+ *  The kernels in vex::pixel work on four pixels at a time using the compiler's
+ *  generic vector types, these compile to NEON with the -mfpu=neon flag in
+ *  mkenv.mk and to SSE on a desktop host.  vex::pixel::scalar holds plain
+ *  per pixel versions that give identical results, used as the reference by
+ *  tools/host/pixelbench.cpp.
+ *  Strides are in pixels.  ARGB sources carry alpha in the top byte, 255 is
+ *  opaque.  RGB565 values are in the usual 0bRRRRRGGGGGGBBBBB order.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace pixel
+  {
+    namespace scalar
+    {
+      /**
+       * @brief Fills a rectangle of pixels with one color.
+       * @param dst Pointer to the top left pixel.
+       * @param stride The number of pixels between rows of dst.
+       * @param width The width in pixels.
+       * @param height The height in pixels.
+       * @param rgb The fill color.
+       */
+      inline void fill(uint32_t *dst, int32_t stride, int32_t width, int32_t height, uint32_t rgb)
+      {
+        for (int32_t y = 0; y < height; y++, dst += stride)
+          for (int32_t x = 0; x < width; x++)
+            dst[x] = rgb;
+      }
+
+      /**
+       * @brief Copies a rectangle of pixels.
+       * @param dst Pointer to the top left destination pixel.
+       * @param dstStride The number of pixels between rows of dst.
+       * @param src Pointer to the top left source pixel.
+       * @param srcStride The number of pixels between rows of src.
+       * @param width The width in pixels.
+       * @param height The height in pixels.
+       */
+      inline void copy(uint32_t *dst, int32_t dstStride, const uint32_t *src, int32_t srcStride, int32_t width, int32_t height)
+      {
+        for (int32_t y = 0; y < height; y++, dst += dstStride, src += srcStride)
+          for (int32_t x = 0; x < width; x++)
+            dst[x] = src[x];
+      }
+
+      // blends one ARGB pixel over one RGB pixel, dividing by 255 with rounding
+      inline uint32_t blend(uint32_t s, uint32_t d)
+      {
+        uint32_t a = s >> 24;
+        uint32_t ia = 255 - a;
+        uint32_t rb = (s & 0xFF00FF) * a + (d & 0xFF00FF) * ia + 0x800080;
+        uint32_t g = ((s >> 8) & 0xFF) * a + ((d >> 8) & 0xFF) * ia + 0x80;
+        rb = ((rb + ((rb >> 8) & 0xFF00FF)) >> 8) & 0xFF00FF;
+        g = ((g + (g >> 8)) >> 8) & 0xFF;
+        return rb | (g << 8);
+      }
+
+      /**
+       * @brief Blends a rectangle of ARGB pixels over a rectangle of RGB pixels.
+       * @param dst Pointer to the top left destination pixel.
+       * @param dstStride The number of pixels between rows of dst.
+       * @param src Pointer to the top left ARGB source pixel.
+       * @param srcStride The number of pixels between rows of src.
+       * @param width The width in pixels.
+       * @param height The height in pixels.
+       */
+      inline void blend(uint32_t *dst, int32_t dstStride, const uint32_t *src, int32_t srcStride, int32_t width, int32_t height)
+      {
+        for (int32_t y = 0; y < height; y++, dst += dstStride, src += srcStride)
+          for (int32_t x = 0; x < width; x++)
+            dst[x] = blend(src[x], dst[x]);
+      }
+
+      /**
+       * @brief Converts RGB pixels to RGB565.
+       * @param dst The RGB565 output.
+       * @param src The RGB input.
+       * @param count The number of pixels.
+       */
+      inline void toRgb565(uint16_t *dst, const uint32_t *src, int32_t count)
+      {
+        for (int32_t i = 0; i < count; i++)
+        {
+          uint32_t p = src[i];
+          dst[i] = ((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F);
+        }
+      }
+
+      /**
+       * @brief Converts RGB565 pixels to RGB, the low bits of each channel repeat the high bits.
+       * @param dst The RGB output.
+       * @param src The RGB565 input.
+       * @param count The number of pixels.
+       */
+      inline void fromRgb565(uint32_t *dst, const uint16_t *src, int32_t count)
+      {
+        for (int32_t i = 0; i < count; i++)
+        {
+          uint32_t c = src[i];
+          uint32_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+          dst[i] = (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+        }
+      }
+    };
+
+    typedef uint32_t _u32x4 __attribute__((vector_size(16)));
+    typedef uint16_t _u16x4 __attribute__((vector_size(8)));
+
+    // unaligned vector loads and stores, a single vld1/vst1 on NEON
+    inline _u32x4 _load(const uint32_t *p)
+    {
+      _u32x4 v;
+      __builtin_memcpy(&v, p, sizeof(v));
+      return v;
+    }
+    inline void _store(uint32_t *p, _u32x4 v)
+    {
+      __builtin_memcpy(p, &v, sizeof(v));
+    }
+
+    /**
+     * @brief Fills a rectangle of pixels with one color.
+     * @param dst Pointer to the top left pixel.
+     * @param stride The number of pixels between rows of dst.
+     * @param width The width in pixels.
+     * @param height The height in pixels.
+     * @param rgb The fill color.
+     */
+    inline void fill(uint32_t *dst, int32_t stride, int32_t width, int32_t height, uint32_t rgb)
+    {
+      _u32x4 v = {rgb, rgb, rgb, rgb};
+
+      for (int32_t y = 0; y < height; y++, dst += stride)
+      {
+        int32_t x = 0;
+        for (; x + 16 <= width; x += 16)
+        {
+          _store(dst + x, v);
+          _store(dst + x + 4, v);
+          _store(dst + x + 8, v);
+          _store(dst + x + 12, v);
+        }
+        for (; x + 4 <= width; x += 4)
+          _store(dst + x, v);
+        for (; x < width; x++)
+          dst[x] = rgb;
+      }
+    }
+
+    /**
+     * @brief Copies a rectangle of pixels, the rectangles must not overlap.
+     * @param dst Pointer to the top left destination pixel.
+     * @param dstStride The number of pixels between rows of dst.
+     * @param src Pointer to the top left source pixel.
+     * @param srcStride The number of pixels between rows of src.
+     * @param width The width in pixels.
+     * @param height The height in pixels.
+     */
+    inline void copy(uint32_t *dst, int32_t dstStride, const uint32_t *src, int32_t srcStride, int32_t width, int32_t height)
+    {
+      for (int32_t y = 0; y < height; y++, dst += dstStride, src += srcStride)
+      {
+        int32_t x = 0;
+        for (; x + 8 <= width; x += 8)
+        {
+          _u32x4 a = _load(src + x);
+          _u32x4 b = _load(src + x + 4);
+          _store(dst + x, a);
+          _store(dst + x + 4, b);
+        }
+        for (; x < width; x++)
+          dst[x] = src[x];
+      }
+    }
+
+    /**
+     * @brief Blends a rectangle of ARGB pixels over a rectangle of RGB pixels.
+     * @param dst Pointer to the top left destination pixel.
+     * @param dstStride The number of pixels between rows of dst.
+     * @param src Pointer to the top left ARGB source pixel.
+     * @param srcStride The number of pixels between rows of src.
+     * @param width The width in pixels.
+     * @param height The height in pixels.
+     */
+    inline void blend(uint32_t *dst, int32_t dstStride, const uint32_t *src, int32_t srcStride, int32_t width, int32_t height)
+    {
+      const _u32x4 mrb = {0xFF00FF, 0xFF00FF, 0xFF00FF, 0xFF00FF};
+
+      for (int32_t y = 0; y < height; y++, dst += dstStride, src += srcStride)
+      {
+        int32_t x = 0;
+        for (; x + 4 <= width; x += 4)
+        {
+          // same arithmetic as scalar::blend, four pixels per step
+          _u32x4 s = _load(src + x);
+          _u32x4 d = _load(dst + x);
+          _u32x4 a = s >> 24;
+          _u32x4 ia = 255 - a;
+          _u32x4 rb = (s & mrb) * a + (d & mrb) * ia + 0x800080;
+          _u32x4 g = ((s >> 8) & 0xFF) * a + ((d >> 8) & 0xFF) * ia + 0x80;
+          rb = ((rb + ((rb >> 8) & mrb)) >> 8) & mrb;
+          g = ((g + (g >> 8)) >> 8) & 0xFF;
+          _store(dst + x, rb | (g << 8));
+        }
+        for (; x < width; x++)
+          dst[x] = scalar::blend(src[x], dst[x]);
+      }
+    }
+
+    /**
+     * @brief Converts RGB pixels to RGB565.
+     * @param dst The RGB565 output.
+     * @param src The RGB input.
+     * @param count The number of pixels.
+     */
+    inline void toRgb565(uint16_t *dst, const uint32_t *src, int32_t count)
+    {
+      int32_t i = 0;
+      for (; i + 4 <= count; i += 4)
+      {
+        _u32x4 p = _load(src + i);
+        _u16x4 c = __builtin_convertvector(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F), _u16x4);
+        __builtin_memcpy(dst + i, &c, sizeof(c));
+      }
+      scalar::toRgb565(dst + i, src + i, count - i);
+    }
+
+    /**
+     * @brief Converts RGB565 pixels to RGB, the low bits of each channel repeat the high bits.
+     * @param dst The RGB output.
+     * @param src The RGB565 input.
+     * @param count The number of pixels.
+     */
+    inline void fromRgb565(uint32_t *dst, const uint16_t *src, int32_t count)
+    {
+      int32_t i = 0;
+      for (; i + 4 <= count; i += 4)
+      {
+        _u16x4 c16;
+        __builtin_memcpy(&c16, src + i, sizeof(c16));
+        _u32x4 c = __builtin_convertvector(c16, _u32x4);
+        _u32x4 r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        _store(dst + i, (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2)));
+      }
+      scalar::fromRgb565(dst + i, src + i, count - i);
+    }
+  };
+};
+
+#endif // VEX_PIXEL_H
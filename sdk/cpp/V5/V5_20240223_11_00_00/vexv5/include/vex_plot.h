@@ -0,0 +1,261 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_plot.h                                                  */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_PLOT_CLASS_H
+#define VEX_PLOT_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_plot.h
+ * @brief   Scrolling time series plot class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief plot class                                                          */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define PLOT_MAX_TRACES 4
+#define PLOT_MAX_WIDTH SYSTEM_DISPLAY_WIDTH
+
+  /**
+   * @brief Use the plot class to show live values, such as PID error or motor current, as a scrolling graph.
+   * @details
+   *  Each call to add() or addValues() stores one sample per trace in a ring
+   *  buffer and draws a single new column into an offscreen canvas.  The
+   *  canvas is itself used as a ring of columns, so nothing is scrolled or
+   *  redrawn, render() copies it to the screen oldest column first with at
+   *  most two vexDisplayCopyRect calls.  render() skips the empty columns
+   *  left of the samples once they are on the screen and copies nothing
+   *  when no sample was added since the last call.  Only setRange(),
+   *  setColor() and setBackground() redraw every column, from the stored
+   *  samples.
+   *  Coordinates are in screen pixels, the lcd origin is not applied.
+   */
+  class plot
+  {
+  public:
+    /**
+     * @brief Creates a new plot.
+     * @param x The screen x-coordinate of the left edge.
+     * @param y The screen y-coordinate of the top edge.
+     * @param width The width in pixels, one sample per column, at most PLOT_MAX_WIDTH.
+     * @param height The height in pixels.
+     * @param traces The number of traces, at most PLOT_MAX_TRACES.
+     */
+    plot(int32_t x, int32_t y, int32_t width, int32_t height, int32_t traces = 1)
+        : _x(x), _y(y),
+          _width(width < 1 ? 1 : width > PLOT_MAX_WIDTH ? PLOT_MAX_WIDTH : width),
+          _height(height < 2 ? 2 : height),
+          _traces(traces < 1 ? 1 : traces > PLOT_MAX_TRACES ? PLOT_MAX_TRACES : traces),
+          _canvas(_width, _height, 0x000000)
+    {
+      static const uint32_t colors[PLOT_MAX_TRACES] = {0xFF0000, 0x00FF00, 0x00A0FF, 0xFFFF00};
+      for (int32_t t = 0; t < PLOT_MAX_TRACES; t++)
+        _color[t] = colors[t];
+      _background = 0x000000;
+      _grid = 0x303030;
+      _min = -1;
+      _max = 1;
+      clear();
+    }
+    ~plot() {};
+
+    /**
+     * @brief Sets the value range shown, values outside it are drawn at the edge.
+     * @param min The value at the bottom edge.
+     * @param max The value at the top edge.
+     */
+    void setRange(double min, double max)
+    {
+      if (max <= min)
+        return;
+      _min = min;
+      _max = max;
+      _redraw();
+    }
+
+    /**
+     * @brief Sets the color of a trace.
+     * @param trace The trace index, starting at 0.
+     * @param rgb The color.
+     */
+    void setColor(int32_t trace, uint32_t rgb)
+    {
+      if (trace >= 0 && trace < PLOT_MAX_TRACES)
+      {
+        _color[trace] = rgb;
+        _redraw();
+      }
+    }
+
+    /**
+     * @brief Sets the background color and the color of the zero line.
+     * @param background The background color.
+     * @param grid The color of the line drawn at value 0 when it is in range.
+     */
+    void setBackground(uint32_t background, uint32_t grid)
+    {
+      _background = background;
+      _grid = grid;
+      _redraw();
+    }
+
+    /**
+     * @brief Adds one sample to every trace and draws the new column.
+     * @param values Pointer to one value per trace.
+     */
+    void addValues(const double *values)
+    {
+      int32_t col = _head;
+      for (int32_t t = 0; t < _traces; t++)
+        _samples[t][col] = (float)values[t];
+
+      _head = (_head + 1) % _width;
+      if (_count < _width)
+        _count++;
+      if (_dirty > _width - _count)
+        _dirty = _width - _count;
+
+      _drawColumn(col);
+      // the oldest column loses the segment to the sample that scrolled out
+      if (_count == _width)
+        _drawColumn(_head);
+    }
+
+    /**
+     * @brief Adds one sample to each of the first traces, any other traces repeat their last value.
+     * @param v0 The value for trace 0.
+     * @param rest The values for the following traces.
+     */
+    template <class... T>
+    void add(double v0, T... rest)
+    {
+      double values[PLOT_MAX_TRACES] = {v0, (double)rest...};
+      int32_t prev = (_head + _width - 1) % _width;
+      for (int32_t t = 1 + sizeof...(rest); t < _traces; t++)
+        values[t] = _count > 0 ? _samples[t][prev] : 0;
+      addValues(values);
+    }
+
+    /**
+     * @brief Gets a stored sample.
+     * @return Returns the value, or 0 if the sample is not held.
+     * @param trace The trace index, starting at 0.
+     * @param age The age of the sample, 0 is the newest.
+     */
+    double value(int32_t trace, int32_t age = 0) const
+    {
+      if (trace < 0 || trace >= _traces || age < 0 || age >= _count)
+        return 0;
+      return _samples[trace][(_head + _width - 1 - age) % _width];
+    }
+
+    int32_t count() const { return _count; }
+
+    /**
+     * @brief Removes every sample.
+     */
+    void clear()
+    {
+      _head = 0;
+      _count = 0;
+      _redraw();
+    }
+
+    /**
+     * @brief Copies what changed to the screen, the newest sample is at the right edge.
+     * @param all Set to true to copy the whole plot, for example after the screen was cleared.
+     */
+    void render(bool all = false)
+    {
+      // screen column s shows canvas column (_head + s) % _width
+      int32_t s = all ? 0 : _dirty;
+      while (s < _width)
+      {
+        int32_t col = (_head + s) % _width;
+        int32_t n = _width - col < _width - s ? _width - col : _width - s;
+        _canvas.blit(_x + s, _y, col, 0, n, _height);
+        s += n;
+      }
+      _dirty = _width;
+    }
+
+  private:
+    int32_t _x;
+    int32_t _y;
+    int32_t _width;
+    int32_t _height;
+    int32_t _traces;
+    brain::lcd::canvas _canvas;
+    uint32_t _color[PLOT_MAX_TRACES];
+    uint32_t _background;
+    uint32_t _grid;
+    double _min;
+    double _max;
+    int32_t _head;  // next column written
+    int32_t _count; // samples held
+    int32_t _dirty; // first screen column render() copies
+    float _samples[PLOT_MAX_TRACES][PLOT_MAX_WIDTH];
+
+    int32_t _row(double v) const
+    {
+      int32_t row = (int32_t)((_max - v) * (_height - 1) / (_max - _min) + 0.5);
+      return row < 0 ? 0 : row >= _height ? _height - 1 : row;
+    }
+
+    void _drawColumn(int32_t col)
+    {
+      uint32_t *p = _canvas.data();
+      if (p == nullptr)
+        return;
+      p += col;
+      const int32_t stride = brain::lcd::canvas::stride();
+
+      for (int32_t row = 0; row < _height; row++)
+        p[row * stride] = _background;
+      if (_min < 0 && _max > 0)
+        p[_row(0) * stride] = _grid;
+
+      // the oldest sample has nothing to connect to
+      bool first = _count < _width ? col == 0 : col == _head;
+      int32_t prev = (col + _width - 1) % _width;
+
+      for (int32_t t = 0; t < _traces; t++)
+      {
+        int32_t r1 = _row(_samples[t][col]);
+        int32_t r0 = first ? r1 : _row(_samples[t][prev]);
+        if (r0 > r1)
+        {
+          int32_t tmp = r0;
+          r0 = r1;
+          r1 = tmp;
+        }
+        for (int32_t row = r0; row <= r1; row++)
+          p[row * stride] = _color[t];
+      }
+    }
+
+    void _redraw()
+    {
+      _dirty = 0;
+      _canvas.clear(_background);
+      if (_min < 0 && _max > 0)
+        _canvas.drawRectangle(0, _row(0), _width, 1, _grid, true);
+
+      int32_t start = _count < _width ? 0 : _head;
+      for (int32_t i = 0; i < _count; i++)
+        _drawColumn((start + i) % _width);
+    }
+  };
+};
+
+#endif // VEX_PLOT_CLASS_H
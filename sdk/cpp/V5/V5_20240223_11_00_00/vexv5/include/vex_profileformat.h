@@ -0,0 +1,74 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_profileformat.h                                         */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_PROFILEFORMAT_H
+#define VEX_PROFILEFORMAT_H
+
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_profileformat.h
+ * @brief   Sampling profile format
+ * @details
+ *  A profile starts with a PROFILE_HEADER_SIZE byte header, the magic
+ *  uint32_t, version and the sample interval in mS as a uint16_t, followed
+ *  by uint32_t words, all little endian.  Each word is the address of the
+ *  instruction a sample interrupted, except PROFILE_DROPPED, which is
+ *  followed by the number of samples lost because the buffer was full.
+ *  A file may hold several profiles one after the other, no code address
+ *  is PROFILE_MAGIC.
+ *  tools/host/profreport.cpp reads profiles with it.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace profileformat
+  {
+#define PROFILE_MAGIC 0x46503556 // "V5PF"
+#define PROFILE_VERSION 1
+#define PROFILE_HEADER_SIZE 7
+#define PROFILE_DROPPED 0xFFFFFFFF
+
+    /**
+     * @brief Writes a profile header.
+     * @param p The output, PROFILE_HEADER_SIZE bytes.
+     * @param interval The sample interval in mS.
+     */
+    inline void putHeader(uint8_t *p, uint16_t interval)
+    {
+      p[0] = (uint8_t)PROFILE_MAGIC;
+      p[1] = (uint8_t)(PROFILE_MAGIC >> 8);
+      p[2] = (uint8_t)(PROFILE_MAGIC >> 16);
+      p[3] = (uint8_t)(PROFILE_MAGIC >> 24);
+      p[4] = PROFILE_VERSION;
+      p[5] = (uint8_t)interval;
+      p[6] = (uint8_t)(interval >> 8);
+    }
+
+    /**
+     * @brief Reads a profile header.
+     * @return Returns false if p is not the start of a profile.
+     * @param p The input, PROFILE_HEADER_SIZE bytes.
+     * @param interval Set to the sample interval in mS.
+     */
+    inline bool getHeader(const uint8_t *p, uint16_t &interval)
+    {
+      uint32_t magic = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+      if (magic != PROFILE_MAGIC || p[4] != PROFILE_VERSION)
+        return false;
+      interval = p[5] | (p[6] << 8);
+      return interval > 0;
+    }
+  };
+};
+
+#endif // VEX_PROFILEFORMAT_H
@@ -0,0 +1,191 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_profiler.h                                              */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_PROFILER_CLASS_H
+#define VEX_PROFILER_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_profiler.h
+ * @brief   Sampling profiler class header
+ */
+/*---------------------------------------------------------------------------*/
+
+// sampling support in vex/vex_profiler.cpp, only linked with PROFILER = 1
+extern "C"
+{
+  bool vexProfilerInstall(uint32_t interval) __attribute__((weak));
+  void vexProfilerRemove(void) __attribute__((weak));
+  uint32_t vexProfilerRead(uint32_t *samples, uint32_t max) __attribute__((weak));
+  uint32_t vexProfilerDropped(void) __attribute__((weak));
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief profiler class                                                      */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define PROFILER_FLUSH 50
+#define PROFILER_CHUNK 128
+
+  /**
+   * @brief Use the profiler class to find where a program spends its time on the brain.
+   * @details
+   *  Build with PROFILER = 1 in the makefile, that links vex/vex_profiler.cpp.
+   *  While the profiler runs, every interval'th system timer interrupt, one
+   *  every mS, stores the address of the instruction it interrupted in a
+   *  buffer.  Every PROFILER_FLUSH mS a low priority task writes the samples
+   *  through an sdlogger, see vex_profileformat.h.  Samples are taken in any
+   *  task and in the system code, the program itself is not changed, so
+   *  release builds can be profiled as they are.  Samples that do not fit
+   *  in the buffer are counted in the file.
+   *  tools/host/profreport lists the functions with the most samples using
+   *  the .elf or .map file from the same build, and can write the hottest
+   *  ones as an ORDER_FILE for the makefile.
+   *  Without PROFILER = 1, or when the brain uses fixed high vectors or
+   *  takes exceptions in Thumb state (SCTLR.V or SCTLR.TE set), start()
+   *  returns false.
+   *
+   * @code
+   *  sdlogger log("run.prf", false);
+   *  profiler prof(log, 2);  // 500 samples a second
+   *
+   *  int main() {
+   *    prof.start();
+   *    ...
+   *  }
+   * @endcode
+   */
+  class profiler
+  {
+  public:
+    /**
+     * @brief Creates a new profiler, nothing is sampled until start().
+     * @param log The logger samples are written to, it is started by start() if needed.
+     * @param interval Take a sample every interval mS.
+     * @param priority The priority of the writer task.
+     */
+    profiler(sdlogger &log, uint32_t interval = 1, int32_t priority = task::taskPrioritylow) : _log(log)
+    {
+      _interval = interval < 1 ? 1 : interval > 0xFFFF ? 0xFFFF : interval;
+      _priority = priority;
+      _running = false;
+      _stopping = false;
+      _samples = 0;
+      _dropped = 0;
+      _lost = 0;
+    }
+    ~profiler() {};
+
+    profiler(const profiler &) = delete;
+    profiler &operator=(const profiler &) = delete;
+
+    /**
+     * @brief Starts sampling and the writer task.
+     * @return Returns false if sampling is not available or the log cannot be started.
+     */
+    bool start()
+    {
+      if (_running || vexProfilerInstall == nullptr)
+        return false;
+      if (!_log.running() && !_log.start())
+        return false;
+      uint8_t header[PROFILE_HEADER_SIZE];
+      profileformat::putHeader(header, _interval);
+      if (!vexProfilerInstall(_interval))
+        return false;
+      if (!_log.write(header, sizeof(header)))
+      {
+        vexProfilerRemove();
+        return false;
+      }
+      _samples = 0;
+      _dropped = 0;
+      _lost = 0;
+      _running = true;
+      _stopping = false;
+      _task = task(_writer, this, _priority);
+      return true;
+    }
+
+    /**
+     * @brief Stops sampling, the writer task writes what is left and ends.
+     */
+    void stop()
+    {
+      if (_running)
+        _stopping = true;
+    }
+
+    /**
+     * @brief Checks if the profiler is running.
+     * @return Returns true from start() until stop() has written everything.
+     */
+    bool running() const { return _running; }
+
+    uint32_t samples() const { return _samples; }
+    uint32_t dropped() const { return _dropped; }
+    uint32_t lost() const { return _lost; }
+
+  private:
+    sdlogger &_log;
+    uint16_t _interval;
+    int32_t _priority;
+    task _task;
+    volatile bool _running;
+    volatile bool _stopping;
+    uint32_t _samples;
+    uint32_t _dropped; // samples the buffer dropped, already in the file
+    uint32_t _lost;    // samples the logger did not take
+
+    static int _writer(void *arg)
+    {
+      profiler *self = (profiler *)arg;
+      while (true)
+      {
+        bool stopping = self->_stopping;
+        if (stopping)
+          vexProfilerRemove();
+        self->_drain();
+        if (stopping)
+          break;
+        task::sleep(PROFILER_FLUSH);
+      }
+      self->_log.flush();
+      self->_stopping = false;
+      self->_running = false;
+      return 0;
+    }
+
+    void _drain()
+    {
+      uint32_t buf[PROFILER_CHUNK];
+      uint32_t n;
+      while ((n = vexProfilerRead(buf, PROFILER_CHUNK)) > 0)
+      {
+        // the brain is little endian like the file
+        if (_log.write(buf, n * sizeof(uint32_t)))
+          _samples += n;
+        else
+          _lost += n;
+      }
+
+      uint32_t dropped = vexProfilerDropped();
+      if (dropped != _dropped)
+      {
+        uint32_t marker[2] = {PROFILE_DROPPED, dropped - _dropped};
+        if (_log.write(marker, sizeof(marker)))
+          _dropped = dropped;
+      }
+    }
+  };
+};
+
+#endif // VEX_PROFILER_CLASS_H
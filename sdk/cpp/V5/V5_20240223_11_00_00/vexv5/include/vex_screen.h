@@ -0,0 +1,384 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_screen.h                                                */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_SCREEN_CLASS_H
+#define VEX_SCREEN_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_screen.h
+ * @brief   Retained mode screen layer with dirty rectangle tracking
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief screen rectangle                                                    */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+  /**
+   * @brief A rectangle in screen pixel coordinates.
+   */
+  struct rect
+  {
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+
+    bool empty() const { return width <= 0 || height <= 0; }
+    int32_t area() const { return empty() ? 0 : width * height; }
+    int32_t right() const { return x + width; }
+    int32_t bottom() const { return y + height; }
+
+    bool contains(int32_t px, int32_t py) const
+    {
+      return px >= x && py >= y && px < right() && py < bottom();
+    }
+
+    bool intersects(const rect &r) const
+    {
+      return !empty() && !r.empty() && r.x < right() && x < r.right() && r.y < bottom() && y < r.bottom();
+    }
+
+    // true if the rectangles overlap or share an edge
+    bool touches(const rect &r) const
+    {
+      return !empty() && !r.empty() && r.x <= right() && x <= r.right() && r.y <= bottom() && y <= r.bottom();
+    }
+
+    rect intersect(const rect &r) const
+    {
+      int32_t x1 = x > r.x ? x : r.x;
+      int32_t y1 = y > r.y ? y : r.y;
+      int32_t x2 = right() < r.right() ? right() : r.right();
+      int32_t y2 = bottom() < r.bottom() ? bottom() : r.bottom();
+      if (x2 <= x1 || y2 <= y1)
+        return rect{0, 0, 0, 0};
+      return rect{x1, y1, x2 - x1, y2 - y1};
+    }
+
+    rect unite(const rect &r) const
+    {
+      if (empty())
+        return r;
+      if (r.empty())
+        return *this;
+      int32_t x1 = x < r.x ? x : r.x;
+      int32_t y1 = y < r.y ? y : r.y;
+      int32_t x2 = right() > r.right() ? right() : r.right();
+      int32_t y2 = bottom() > r.bottom() ? bottom() : r.bottom();
+      return rect{x1, y1, x2 - x1, y2 - y1};
+    }
+  };
+};
+
+/*-----------------------------------------------------------------------------*/
+/** @brief dirty region list                                                   */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+  /**
+   * @brief A fixed size list of dirty rectangles that merges overlapping or touching entries.
+   * @details
+   *  When the list is full the pair whose union adds the least area is merged,
+   *  so any number of invalidations costs at most len rectangles to redraw.
+   */
+  template <int len>
+  class dirtylist
+  {
+    static_assert(len >= 1, "a dirty list needs at least one entry");
+
+  private:
+    rect _rects[len];
+    int32_t _count;
+
+    void _remove(int32_t i)
+    {
+      _rects[i] = _rects[--_count];
+    }
+
+  public:
+    dirtylist() : _count(0) {}
+
+    void clear() { _count = 0; }
+    int32_t count() const { return _count; }
+    bool empty() const { return _count == 0; }
+    const rect &operator[](int32_t i) const { return _rects[i]; }
+    const rect *begin() const { return _rects; }
+    const rect *end() const { return _rects + _count; }
+
+    /**
+     * @brief Adds a dirty rectangle, merging it with any entry it touches.
+     * @param r The rectangle to add.
+     */
+    void add(rect r)
+    {
+      if (r.empty())
+        return;
+
+      // absorb every entry the new rectangle touches, repeat as it grows
+      for (int32_t i = 0; i < _count;)
+      {
+        if (_rects[i].touches(r))
+        {
+          r = r.unite(_rects[i]);
+          _remove(i);
+          i = 0;
+        }
+        else
+          i++;
+      }
+
+      // a single entry takes every rectangle
+      if (len == 1 && _count == 1)
+      {
+        _rects[0] = _rects[0].unite(r);
+        return;
+      }
+
+      if (_count == len)
+      {
+        // merge the pair that grows the dirty area the least
+        int32_t bi = 0, bj = 1;
+        int32_t best = INT32_MAX;
+        for (int32_t i = 0; i < _count; i++)
+        {
+          for (int32_t j = i + 1; j < _count; j++)
+          {
+            int32_t cost = _rects[i].unite(_rects[j]).area() - _rects[i].area() - _rects[j].area();
+            if (cost < best)
+            {
+              best = cost;
+              bi = i;
+              bj = j;
+            }
+          }
+        }
+        _rects[bi] = _rects[bi].unite(_rects[bj]);
+        _remove(bj);
+      }
+
+      _rects[_count++] = r;
+    }
+  };
+};
+
+/*-----------------------------------------------------------------------------*/
+/** @brief retained mode screen                                                */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+  class screen;
+
+#define SCREEN_MAX_DIRTY 16
+
+  /**
+   * @brief Base class for anything drawn by a screen.
+   * @details
+   *  draw() is only called for elements that intersect a dirty region, with the
+   *  display clip region already set to that region.  Call invalidate() when the
+   *  element's content changes.
+   */
+  class element
+  {
+    friend class screen;
+
+  private:
+    screen *_screen;
+    element *_next;
+
+  protected:
+    rect _bounds;
+    bool _visible;
+
+  public:
+    element(int32_t x, int32_t y, int32_t width, int32_t height)
+        : _screen(nullptr), _next(nullptr), _bounds{x, y, width, height}, _visible(true) {}
+    virtual ~element() {};
+
+    /**
+     * @brief Draws the element.
+     * @param clip The dirty region being redrawn, the element may skip anything outside it.
+     */
+    virtual void draw(const rect &clip) = 0;
+
+    const rect &bounds() const { return _bounds; }
+    bool visible() const { return _visible; }
+
+    inline void invalidate();
+    inline void setBounds(const rect &r);
+    inline void setVisible(bool value);
+  };
+
+  /**
+   * @brief Use the screen class to redraw only the parts of the display that changed.
+   * @details
+   *  Elements are drawn in the order they were added.  render() clears each dirty
+   *  region to the background color and redraws the elements over it, nothing
+   *  outside the dirty regions is touched.  Use the screen with the display in
+   *  its default single buffered mode, lcd::render() copies the whole frame.
+   */
+  class screen
+  {
+  public:
+    screen(uint32_t background = 0x000000) : _first(nullptr), _background(background)
+    {
+      invalidateAll();
+    }
+    ~screen() {};
+
+    /**
+     * @brief Adds an element to the end of the draw order.
+     * @param e The element to add, it must outlive the screen or be removed first.
+     */
+    void add(element &e)
+    {
+      if (e._screen != nullptr)
+        return;
+      e._screen = this;
+      e._next = nullptr;
+      element **pp = &_first;
+      while (*pp != nullptr)
+        pp = &(*pp)->_next;
+      *pp = &e;
+      e.invalidate();
+    }
+
+    /**
+     * @brief Removes an element, the area it covered is redrawn.
+     * @param e The element to remove.
+     */
+    void remove(element &e)
+    {
+      for (element **pp = &_first; *pp != nullptr; pp = &(*pp)->_next)
+      {
+        if (*pp == &e)
+        {
+          e.invalidate();
+          *pp = e._next;
+          e._screen = nullptr;
+          e._next = nullptr;
+          return;
+        }
+      }
+    }
+
+    /**
+     * @brief Marks a region of the screen as needing a redraw.
+     * @param r The region in screen coordinates.
+     */
+    void invalidate(const rect &r)
+    {
+      _dirty.add(r.intersect(bounds()));
+    }
+
+    /**
+     * @brief Marks the whole screen as needing a redraw.
+     */
+    void invalidateAll()
+    {
+      _dirty.clear();
+      _dirty.add(bounds());
+    }
+
+    /**
+     * @brief Sets the color used to clear dirty regions before elements are drawn.
+     * @param rgb The background color.
+     */
+    void setBackground(uint32_t rgb)
+    {
+      _background = rgb;
+      invalidateAll();
+    }
+
+    bool dirty() const { return !_dirty.empty(); }
+    const dirtylist<SCREEN_MAX_DIRTY> &regions() const { return _dirty; }
+    static rect bounds() { return rect{0, 0, SYSTEM_DISPLAY_WIDTH, SYSTEM_DISPLAY_HEIGHT}; }
+
+    /**
+     * @brief Redraws every dirty region.
+     * @return Returns the number of regions redrawn.
+     */
+    int32_t render()
+    {
+      int32_t count = _dirty.count();
+      if (count == 0)
+        return 0;
+
+      uint32_t fg = vexDisplayForegroundColorGet();
+
+      for (const rect &r : _dirty)
+      {
+        vexDisplayClipRegionSet(r.x, r.y, r.right() - 1, r.bottom() - 1);
+        vexDisplayForegroundColor(_background);
+        vexDisplayRectFill(r.x, r.y, r.right() - 1, r.bottom() - 1);
+
+        for (element *e = _first; e != nullptr; e = e->_next)
+        {
+          if (e->_visible && e->_bounds.intersects(r))
+            e->draw(r);
+        }
+      }
+
+      vexDisplayClipRegionClear();
+      vexDisplayForegroundColor(fg);
+      _dirty.clear();
+
+      return count;
+    }
+
+    /**
+     * @brief Copies the dirty regions of a frame composed in memory to the display.
+     * @return Returns the number of regions copied.
+     * @param pixels Pointer to a full screen frame of 32 bit pixels.
+     * @param stride The number of pixels in each row of the frame.
+     */
+    int32_t flush(uint32_t *pixels, int32_t stride = SYSTEM_DISPLAY_WIDTH)
+    {
+      int32_t count = _dirty.count();
+
+      for (const rect &r : _dirty)
+        vexDisplayCopyRect(r.x, r.y, r.right() - 1, r.bottom() - 1, pixels + r.y * stride + r.x, stride);
+
+      _dirty.clear();
+      return count;
+    }
+
+  private:
+    element *_first;
+    uint32_t _background;
+    dirtylist<SCREEN_MAX_DIRTY> _dirty;
+  };
+
+  void element::invalidate()
+  {
+    if (_screen != nullptr)
+      _screen->invalidate(_bounds);
+  }
+
+  void element::setBounds(const rect &r)
+  {
+    invalidate();
+    _bounds = r;
+    invalidate();
+  }
+
+  void element::setVisible(bool value)
+  {
+    if (_visible != value)
+    {
+      _visible = value;
+      invalidate();
+    }
+  }
+};
+
+#endif // VEX_SCREEN_CLASS_H
@@ -0,0 +1,210 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_screencapture.h                                         */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_SCREENCAPTURE_CLASS_H
+#define VEX_SCREENCAPTURE_CLASS_H
+
+#include <cstdlib>
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_screencapture.h
+ * @brief   Background screen capture to SD card class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief screen capture class                                                */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define SCREENCAPTURE_CHUNK 4096
+#define SCREENCAPTURE_IDLE 20
+#define SCREENCAPTURE_MAX_NAME 32
+
+  /**
+   * @brief Use the screencapture class to save what a canvas shows to the SD card.
+   * @details
+   *  capture() copies the pixels and returns, a low priority task then encodes
+   *  them and writes the file in SCREENCAPTURE_CHUNK byte pieces, yielding
+   *  after each one, so control loops keep running while the SD card is busy.
+   *  One capture is held at a time, capture() returns false while the last
+   *  one is still being written.
+   *  VEXos draws text and shapes in firmware and the display memory cannot
+   *  be read back, so a user interface that should be captured is drawn into
+   *  a brain::lcd::canvas and copied to the screen with blit().
+   *  On a host, captureformat::encoder writes the same files with stdio, see
+   *  tools/host/fbdump.cpp.  Keep the object for the whole program, usually
+   *  as a global, the writer task keeps using it.
+   *
+   * @code
+   *  screencapture shots;
+   *  shots.capture(ui);  // screen001.png, screen002.png, ...
+   * @endcode
+   */
+  class screencapture
+  {
+  public:
+    /**
+     * @brief Creates a new screen capture.
+     * @param priority The priority of the writer task.
+     */
+    screencapture(int32_t priority = task::taskPrioritylow) : _priority(priority)
+    {
+      _started = false;
+      _queued = false;
+      _copy = nullptr;
+      _next = 1;
+      _saved = 0;
+      _failed = 0;
+    }
+    ~screencapture() {};
+
+    screencapture(const screencapture &) = delete;
+    screencapture &operator=(const screencapture &) = delete;
+
+    /**
+     * @brief Saves pixels to a file on the SD card.
+     * @return Returns true if the capture was queued.
+     * @param name The file name, or nullptr to number files screen001 and on.
+     * @param pixels Pointer to the top left 0x00RRGGBB pixel.
+     * @param width The width in pixels, at most CAPTURE_MAX_WIDTH.
+     * @param height The height in pixels.
+     * @param stride The number of pixels between rows.
+     * @param format The file format.
+     */
+    bool capture(const char *name, const uint32_t *pixels, int32_t width, int32_t height, int32_t stride,
+                 captureformat::tCaptureFormat format = captureformat::tCaptureFormat::kCaptureFormatPng)
+    {
+      if (_queued || pixels == nullptr || width <= 0 || width > CAPTURE_MAX_WIDTH || height <= 0)
+        return false;
+      if (!vexFileDriveStatus(0))
+        return false;
+
+      _copy = (uint32_t *)malloc(width * height * 4);
+      if (_copy == nullptr)
+        return false;
+      pixel::copy(_copy, width, pixels, stride, width, height);
+
+      if (name != nullptr)
+        strncpy(_name, name, SCREENCAPTURE_MAX_NAME - 1);
+      else
+        vex_snprintf(_name, SCREENCAPTURE_MAX_NAME, "screen%03lu.%s", (unsigned long)_next++, _extension(format));
+      _name[SCREENCAPTURE_MAX_NAME - 1] = 0;
+      _width = width;
+      _height = height;
+      _format = format;
+      _queued = true;
+
+      if (!_started)
+      {
+        _started = true;
+        _task = task(_writer, this, _priority);
+      }
+      return true;
+    }
+
+    /**
+     * @brief Saves a canvas to a file on the SD card.
+     * @return Returns true if the capture was queued.
+     * @param name The file name, or nullptr to number files screen001 and on.
+     * @param canvas The canvas to save.
+     * @param format The file format.
+     */
+    bool capture(const char *name, const brain::lcd::canvas &canvas,
+                 captureformat::tCaptureFormat format = captureformat::tCaptureFormat::kCaptureFormatPng)
+    {
+      return capture(name, canvas.data(), canvas.width(), canvas.height(), brain::lcd::canvas::stride(), format);
+    }
+
+    /**
+     * @brief Saves a canvas to the next numbered file on the SD card.
+     * @return Returns true if the capture was queued.
+     * @param canvas The canvas to save.
+     */
+    bool capture(const brain::lcd::canvas &canvas)
+    {
+      return capture(nullptr, canvas);
+    }
+
+    /**
+     * @brief Checks if a capture is waiting or being written.
+     * @return Returns true until the last capture is on the SD card.
+     */
+    bool busy() const { return _queued; }
+
+    uint32_t saved() const { return _saved; }
+    uint32_t failed() const { return _failed; }
+
+  private:
+    int32_t _priority;
+    task _task;
+    bool _started;
+    volatile bool _queued;
+    uint32_t *_copy;
+    int32_t _width;
+    int32_t _height;
+    captureformat::tCaptureFormat _format;
+    char _name[SCREENCAPTURE_MAX_NAME];
+    uint32_t _next;
+    uint32_t _saved;
+    uint32_t _failed;
+    uint8_t _chunk[SCREENCAPTURE_CHUNK];
+
+    static const char *_extension(captureformat::tCaptureFormat format)
+    {
+      return format == captureformat::tCaptureFormat::kCaptureFormatPng   ? "png"
+             : format == captureformat::tCaptureFormat::kCaptureFormatBmp ? "bmp"
+                                                                          : "raw";
+    }
+
+    static int _writer(void *arg)
+    {
+      screencapture *self = (screencapture *)arg;
+      while (true)
+      {
+        if (self->_queued)
+          self->_write();
+        else
+          task::sleep(SCREENCAPTURE_IDLE);
+      }
+      return 0;
+    }
+
+    void _write()
+    {
+      bool ok = false;
+      FIL *fp = vexFileOpenCreate(_name);
+      if (fp != nullptr)
+      {
+        captureformat::encoder enc(_copy, _width, _height, _width, _format);
+        ok = enc.valid();
+        uint32_t n;
+        while (ok && (n = enc.next(_chunk, SCREENCAPTURE_CHUNK)) > 0)
+        {
+          ok = vexFileWrite((char *)_chunk, 1, n, fp) == (int32_t)n;
+          task::yield();
+        }
+        vexFileClose(fp);
+      }
+
+      free(_copy);
+      _copy = nullptr;
+      if (ok)
+        _saved++;
+      else
+        _failed++;
+      _queued = false;
+    }
+  };
+};
+
+#endif // VEX_SCREENCAPTURE_CLASS_H
@@ -0,0 +1,349 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_sdlogger.h                                              */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_SDLOGGER_CLASS_H
+#define VEX_SDLOGGER_CLASS_H
+
+#include <cstdarg>
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_sdlogger.h
+ * @brief   Buffered background SD card logger class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief SD card logger class                                                */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define SDLOGGER_BUFFERS 3
+#define SDLOGGER_BUFFER_SIZE (16 * 512)
+#define SDLOGGER_MAX_RECORD 256
+#define SDLOGGER_SYNC 1000
+#define SDLOGGER_IDLE 5
+#define SDLOGGER_MAX_NAME 32
+
+  /**
+   * @brief Use the sdlogger class to log from control loops without waiting for the SD card.
+   * @details
+   *  write() and printf() copy a record into one of SDLOGGER_BUFFERS memory
+   *  buffers and return.  A low priority task writes each buffer once it is
+   *  full, SDLOGGER_BUFFER_SIZE bytes, a whole number of SD sectors, and calls
+   *  vexFileSync every SDLOGGER_SYNC mS, writing out a partly filled buffer
+   *  first, so at most about that much of the log is lost on power off.
+   *  The file is kept open between writes.
+   *  When every buffer is waiting for the SD card a record is dropped whole
+   *  and counted, the caller is never blocked.  write() does not yield, so
+   *  another task cannot run part way through it, it needs no lock and can
+   *  be called from any task.
+   *  With compress() the writer task packs each buffer into a vex_lzformat.h
+   *  block in the scratch memory before writing it, a CSV log typically
+   *  shrinks to half or less, so more can be logged for the same SD card
+   *  time.  A buffer is written as it is while the scratch memory is in use
+   *  elsewhere.
+   *  tools/host/unlz.cpp turns the file back into the log.
+   *
+   * @code
+   *  sdlogger log("drive.csv");
+   *
+   *  int driveTask() {
+   *    log.start();
+   *    while (true) {
+   *      log.printf("%lu,%.2f\n", vexSystemTimeGet(), leftMotor.velocity(pct));
+   *      task::sleep(5);
+   *    }
+   *  }
+   * @endcode
+   */
+  class sdlogger
+  {
+  public:
+    /**
+     * @brief Creates a new logger, nothing is opened until start().
+     * @param name The name of the log file.
+     * @param append Set to true to add to an existing file, false to replace it.
+     * @param priority The priority of the writer task.
+     */
+    sdlogger(const char *name, bool append = true, int32_t priority = task::taskPrioritylow)
+        : _append(append), _priority(priority)
+    {
+      strncpy(_name, name != nullptr ? name : "log.txt", SDLOGGER_MAX_NAME - 1);
+      _name[SDLOGGER_MAX_NAME - 1] = 0;
+      _fp = nullptr;
+      _running = false;
+      _stopping = false;
+      _flush = false;
+      _compress = false;
+      _fill = 0;
+      _drain = 0;
+      for (_buffer &b : _buffers)
+      {
+        b.used = 0;
+        b.full = false;
+      }
+      _records = 0;
+      _dropped = 0;
+      _logged = 0;
+      _written = 0;
+      _errors = 0;
+      _syncs = 0;
+    }
+    ~sdlogger() {};
+
+    sdlogger(const sdlogger &) = delete;
+    sdlogger &operator=(const sdlogger &) = delete;
+
+    /**
+     * @brief Opens the log file and starts the writer task.
+     * @return Returns true if the file is open.
+     */
+    bool start()
+    {
+      if (_running || _stopping)
+        return _running;
+      if (!vexFileDriveStatus(0))
+        return false;
+      _fp = _append ? vexFileOpenWrite(_name) : vexFileOpenCreate(_name);
+      if (_fp == nullptr)
+        return false;
+      _running = true;
+      _task = task(_writer, this, _priority);
+      return true;
+    }
+
+    /**
+     * @brief Writes everything logged so far and closes the file, the writer task then ends.
+     */
+    void stop()
+    {
+      if (_running)
+        _stopping = true;
+    }
+
+    /**
+     * @brief Sets whether buffers are compressed before they are written, call before start().
+     * @param enable Set to true to write a vex_lzformat.h file.
+     */
+    void compress(bool enable)
+    {
+      if (!_running)
+        _compress = enable;
+    }
+
+    /**
+     * @brief Adds a record to the log.
+     * @return Returns true if the record was stored, false if it was dropped.
+     * @param data Pointer to the record.
+     * @param len The length of the record in bytes, at most SDLOGGER_BUFFER_SIZE.
+     */
+    bool write(const void *data, uint32_t len)
+    {
+      if (!_running || _stopping || len > SDLOGGER_BUFFER_SIZE)
+      {
+        _dropped++;
+        return false;
+      }
+
+      // a record that does not fit continues in the next buffer, so every
+      // full buffer is exactly SDLOGGER_BUFFER_SIZE bytes
+      _buffer *b = &_buffers[_fill];
+      _buffer *next = &_buffers[(_fill + 1) % SDLOGGER_BUFFERS];
+      uint32_t room = SDLOGGER_BUFFER_SIZE - b->used;
+      if (b->full || (room < len && next->full))
+      {
+        _dropped++;
+        return false;
+      }
+
+      const uint8_t *src = (const uint8_t *)data;
+      uint32_t first = room < len ? room : len;
+      memcpy(b->data + b->used, src, first);
+      b->used += first;
+      if (b->used == SDLOGGER_BUFFER_SIZE)
+      {
+        b->full = true;
+        _fill = (_fill + 1) % SDLOGGER_BUFFERS;
+      }
+      if (first < len)
+      {
+        memcpy(next->data, src + first, len - first);
+        next->used = len - first;
+      }
+      _records++;
+      _logged += len;
+      return true;
+    }
+
+    /**
+     * @brief Adds a formatted record to the log.
+     * @return Returns true if the record was stored, false if it was dropped.
+     * @param format A format string, longer results are cut at SDLOGGER_MAX_RECORD bytes.
+     */
+    bool printf(const char *format, ...)
+    {
+      char buf[SDLOGGER_MAX_RECORD];
+      va_list args;
+      va_start(args, format);
+      int32_t len = vex_vsnprintf(buf, sizeof(buf), format, args);
+      va_end(args);
+      if (len < 0)
+        len = 0;
+      if (len >= (int32_t)sizeof(buf))
+        len = sizeof(buf) - 1;
+      return write(buf, len);
+    }
+
+    /**
+     * @brief Asks the writer task to write a partly filled buffer and sync soon.
+     */
+    void flush() { _flush = true; }
+
+    /**
+     * @brief Checks if the log file is open.
+     * @return Returns true from start() until stop() has written everything.
+     */
+    bool running() const { return _running; }
+
+    uint32_t records() const { return _records; }
+    uint32_t dropped() const { return _dropped; }
+    uint32_t logged() const { return _logged; }
+    uint32_t written() const { return _written; }
+    uint32_t errors() const { return _errors; }
+    uint32_t syncs() const { return _syncs; }
+
+  private:
+    struct _buffer
+    {
+      uint8_t data[SDLOGGER_BUFFER_SIZE];
+      uint32_t used;
+      volatile bool full; // owned by the writer task until it is written
+    };
+
+    char _name[SDLOGGER_MAX_NAME];
+    bool _append;
+    int32_t _priority;
+    task _task;
+    FIL *_fp;
+    volatile bool _running;
+    volatile bool _stopping;
+    volatile bool _flush;
+    bool _compress;
+    volatile int32_t _fill;  // buffer write() adds to
+    volatile int32_t _drain; // next buffer the writer task writes
+    _buffer _buffers[SDLOGGER_BUFFERS];
+    uint32_t _records;
+    uint32_t _dropped;
+    uint32_t _logged;  // bytes of records stored
+    uint32_t _written; // bytes written to the file
+    uint32_t _errors;
+    uint32_t _syncs;
+
+    static int _writer(void *arg)
+    {
+      sdlogger *self = (sdlogger *)arg;
+      uint32_t lastSync = vexSystemTimeGet();
+      bool dirty = false;
+
+      while (true)
+      {
+        _buffer *b = &self->_buffers[self->_drain];
+        if (b->full)
+        {
+          if (b->used > 0)
+          {
+            self->_writeBuffer(b);
+            dirty = true;
+          }
+          b->used = 0;
+          b->full = false;
+          self->_drain = (self->_drain + 1) % SDLOGGER_BUFFERS;
+          task::yield();
+          continue;
+        }
+
+        uint32_t now = vexSystemTimeGet();
+        bool stopping = self->_stopping;
+        if (stopping || self->_flush || now - lastSync >= SDLOGGER_SYNC)
+        {
+          // take the buffer write() is filling, the others are all empty
+          if (self->_drain == self->_fill && b->used > 0)
+          {
+            b->full = true;
+            self->_fill = (self->_fill + 1) % SDLOGGER_BUFFERS;
+            continue;
+          }
+          if (dirty)
+          {
+            vexFileSync(self->_fp);
+            self->_syncs++;
+            dirty = false;
+          }
+          lastSync = now;
+          self->_flush = false;
+          if (stopping)
+            break;
+        }
+        task::sleep(SDLOGGER_IDLE);
+      }
+
+      vexFileClose(self->_fp);
+      self->_fp = nullptr;
+      self->_stopping = false;
+      self->_running = false;
+      return 0;
+    }
+
+    void _writeBuffer(_buffer *b)
+    {
+      uint32_t len = b->used;
+      bool ok = true;
+      if (_compress)
+      {
+        uint8_t header[LZ_HEADER_SIZE];
+        uint32_t crc = crc::crc32(b->data, b->used);
+        uint32_t packed = _pack(b);
+        if (packed > 0)
+          len = packed;
+        lzformat::putHeader(header, b->used, len, packed == 0, crc);
+        ok = vexFileWrite((char *)header, 1, LZ_HEADER_SIZE, _fp) == LZ_HEADER_SIZE;
+        if (ok)
+          _written += LZ_HEADER_SIZE;
+      }
+      if (ok && vexFileWrite((char *)b->data, 1, len, _fp) == (int32_t)len)
+        _written += len;
+      else
+        _errors++;
+    }
+
+    // compresses a buffer in place, returns 0 if it is left as it is
+    uint32_t _pack(_buffer *b)
+    {
+      void *scratch = nullptr;
+      int32_t need = LZ_TABLE_SIZE * sizeof(uint16_t) + SDLOGGER_BUFFER_SIZE;
+      if (vexScratchMemoryPtr(&scratch) < need || scratch == nullptr)
+        return 0;
+      if (!vexScratchMemoryLock())
+        return 0;
+
+      uint16_t *table = (uint16_t *)scratch;
+      uint8_t *out = (uint8_t *)scratch + LZ_TABLE_SIZE * sizeof(uint16_t);
+      uint32_t packed = lzformat::compress(b->data, b->used, out, b->used - 1, table);
+      if (packed > 0)
+        memcpy(b->data, out, packed);
+      vexScratchMemoryUnlock();
+      return packed;
+    }
+  };
+};
+
+#endif // VEX_SDLOGGER_CLASS_H
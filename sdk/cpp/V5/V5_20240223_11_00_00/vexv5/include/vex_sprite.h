@@ -0,0 +1,174 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_sprite.h                                                */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_SPRITE_CLASS_H
+#define VEX_SPRITE_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_sprite.h
+ * @brief   Compressed RGB565 sprite class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief sprite class                                                        */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define SPRITE_STRIP_PIXELS 4096
+
+  /**
+   * @brief Use the sprite class to draw images converted at build time by tools/host/spritegen.
+   * @details
+   *  A sprite stays in flash as RGB565, run length encoded, see
+   *  vex_spriteformat.h, and is decoded straight to the screen a row at a time,
+   *  so nothing is decoded at startup and no full size 32 bit copy is held.
+   *  Opaque sprites are decoded into a strip of rows that is copied with one
+   *  vexDisplayCopyRect, transparent sprites copy each opaque span of a row.
+   *  Drawing into a canvas decodes directly into its memory.
+   *  Coordinates are in screen pixels, the lcd origin is not applied.  The
+   *  decode strip is shared by every sprite, a draw never yields part way
+   *  so draws from different tasks cannot overlap in it.
+   *
+   * @code
+   *  extern const uint8_t logo[];  // assets/logo.bmp
+   *  sprite s(logo);
+   *  s.draw(10, 10);
+   * @endcode
+   */
+  class sprite
+  {
+  public:
+    /**
+     * @brief Creates a new sprite from converted data.
+     * @param data Pointer to the sprite data, 4 byte aligned.
+     */
+    sprite(const uint8_t *data) : _h(spriteformat::check(data)) {}
+    ~sprite() {};
+
+    /**
+     * @brief Checks if the data is a sprite.
+     * @return Returns true if the sprite can be drawn.
+     */
+    bool valid() const { return _h != nullptr; }
+
+    int32_t width() const { return valid() ? _h->width : 0; }
+    int32_t height() const { return valid() ? _h->height : 0; }
+
+    /**
+     * @brief Gets the number of bytes the sprite data uses.
+     * @return Returns the size in bytes, or 0 if the sprite is not valid.
+     */
+    uint32_t size() const { return valid() ? _h->size : 0; }
+
+    /**
+     * @brief Checks if the sprite has transparent pixels.
+     * @return Returns true if pixels under the sprite can show through.
+     */
+    bool transparent() const { return valid() && (_h->flags & SPRITE_FLAG_TRANSPARENT) != 0; }
+
+    /**
+     * @brief Draws the sprite on the screen, clipped to the display.
+     * @return Returns true if the sprite is valid.
+     * @param x The x-coordinate at which the left edge of the sprite will be drawn.
+     * @param y The y-coordinate at which the top edge of the sprite will be drawn.
+     */
+    bool draw(int32_t x, int32_t y)
+    {
+      if (!valid())
+        return false;
+
+      int32_t x1 = x < 0 ? 0 : x;
+      int32_t y1 = y < 0 ? 0 : y;
+      int32_t x2 = x + _h->width < SYSTEM_DISPLAY_WIDTH ? x + _h->width : SYSTEM_DISPLAY_WIDTH;
+      int32_t y2 = y + _h->height < SYSTEM_DISPLAY_HEIGHT ? y + _h->height : SYSTEM_DISPLAY_HEIGHT;
+      if (x1 >= x2 || y1 >= y2)
+        return true;
+
+      int32_t count = x2 - x1;
+      uint32_t *strip = _strip();
+
+      if (!transparent())
+      {
+        int32_t rows = SPRITE_STRIP_PIXELS / count;
+        for (int32_t row = y1; row < y2; row += rows)
+        {
+          int32_t n = row + rows < y2 ? rows : y2 - row;
+          for (int32_t i = 0; i < n; i++)
+            spriteformat::decodeRow(_h, row + i - y, x1 - x, count, strip + i * count, nullptr);
+          vexDisplayCopyRect(x1, row, x2 - 1, row + n - 1, strip, count);
+        }
+        return true;
+      }
+
+      uint8_t *mask = _mask();
+      for (int32_t row = y1; row < y2; row++)
+      {
+        if (spriteformat::decodeRow(_h, row - y, x1 - x, count, strip, mask) == 0)
+          continue;
+        for (int32_t i = 0; i < count;)
+        {
+          if (!mask[i])
+          {
+            i++;
+            continue;
+          }
+          int32_t start = i;
+          while (i < count && mask[i])
+            i++;
+          vexDisplayCopyRect(x1 + start, row, x1 + i - 1, row, strip + start, count);
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Draws the sprite into a canvas, clipped to the canvas.
+     * @return Returns true if the sprite and canvas are valid.
+     * @param canvas The canvas to draw into.
+     * @param x The canvas x-coordinate at which the left edge of the sprite will be drawn.
+     * @param y The canvas y-coordinate at which the top edge of the sprite will be drawn.
+     */
+    bool draw(brain::lcd::canvas &canvas, int32_t x, int32_t y)
+    {
+      uint32_t *p = canvas.data();
+      if (!valid() || p == nullptr)
+        return false;
+
+      int32_t x1 = x < 0 ? 0 : x;
+      int32_t y1 = y < 0 ? 0 : y;
+      int32_t x2 = x + _h->width < canvas.width() ? x + _h->width : canvas.width();
+      int32_t y2 = y + _h->height < canvas.height() ? y + _h->height : canvas.height();
+
+      // transparent pixels are left unchanged, so rows decode in place
+      for (int32_t row = y1; row < y2 && x1 < x2; row++)
+        spriteformat::decodeRow(_h, row - y, x1 - x, x2 - x1, p + row * brain::lcd::canvas::stride() + x1, nullptr);
+      return true;
+    }
+
+  private:
+    const spriteformat::header *_h;
+
+    static uint32_t *_strip()
+    {
+      static uint32_t strip[SPRITE_STRIP_PIXELS];
+      return strip;
+    }
+
+    static uint8_t *_mask()
+    {
+      static uint8_t mask[SYSTEM_DISPLAY_WIDTH];
+      return mask;
+    }
+  };
+};
+
+#endif // VEX_SPRITE_CLASS_H
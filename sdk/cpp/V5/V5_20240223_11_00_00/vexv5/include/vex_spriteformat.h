@@ -0,0 +1,188 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_spriteformat.h                                          */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_SPRITEFORMAT_H
+#define VEX_SPRITEFORMAT_H
+
+#include <stdint.h>
+
+#include "vex_pixel.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_spriteformat.h
+ * @brief   RGB565 sprite asset format and row decoder
+ * @details
+ *  A sprite is one little endian block, normally a const array written by
+ *  tools/host/spritegen.cpp and linked into .rodata.
+ *
+ *    header       16 bytes, see spriteformat::header
+ *    row table    height uint32_t byte offsets from the start of the sprite,
+ *                 only present when SPRITE_FLAG_RLE is set
+ *    pixel data   uint16_t RGB565 values
+ *
+ *  Without SPRITE_FLAG_RLE every row is width pixels.  With it every row is a
+ *  list of packets that together cover exactly width pixels, each packet
+ *  starts with a uint16_t whose top two bits are the operation and low 14
+ *  bits the pixel count
+ *
+ *    SPRITE_OP_LITERAL  count pixels follow
+ *    SPRITE_OP_REPEAT   one pixel follows, repeated count times
+ *    SPRITE_OP_SKIP     count transparent pixels, nothing follows
+ *
+ *  Identical rows may share one offset.  SPRITE_FLAG_TRANSPARENT is set when
+ *  the sprite has transparent pixels, these are skip packets with RLE and
+ *  pixels equal to the key color without it.
+ *  tools/host/spritegen.cpp builds sprites with it.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace spriteformat
+  {
+#define SPRITE_MAGIC 0x50533556 // "V5SP"
+#define SPRITE_FLAG_RLE 0x0001
+#define SPRITE_FLAG_TRANSPARENT 0x0002
+
+#define SPRITE_OP_LITERAL 0x0000
+#define SPRITE_OP_REPEAT 0x4000
+#define SPRITE_OP_SKIP 0x8000
+#define SPRITE_OP_MASK 0xC000
+#define SPRITE_MAX_RUN 0x3FFF
+
+    /**
+     * @brief The sprite header.
+     */
+    struct header
+    {
+      uint32_t magic;
+      uint16_t width;
+      uint16_t height;
+      uint16_t flags;
+      uint16_t key;  // transparent RGB565 color of sprites without SPRITE_FLAG_RLE
+      uint32_t size; // total bytes, including the header
+    };
+
+    /**
+     * @brief Checks the header of a sprite.
+     * @return Returns the header, or nullptr if the data is not a sprite.
+     * @param data Pointer to the sprite, 4 byte aligned.
+     */
+    inline const header *check(const uint8_t *data)
+    {
+      const header *h = (const header *)data;
+      if (h == nullptr || h->magic != SPRITE_MAGIC || h->width == 0 || h->height == 0)
+        return nullptr;
+      uint32_t table = (h->flags & SPRITE_FLAG_RLE) ? 4u * h->height : 2u * h->width * h->height;
+      return h->size >= sizeof(header) + table ? h : nullptr;
+    }
+
+    /**
+     * @brief Gets the packets or pixels of one row.
+     * @return Returns a pointer to the first uint16_t of the row.
+     * @param h The sprite header.
+     * @param y The row, 0 is the top.
+     */
+    inline const uint16_t *row(const header *h, int32_t y)
+    {
+      if (h->flags & SPRITE_FLAG_RLE)
+        return (const uint16_t *)((const uint8_t *)h + ((const uint32_t *)(h + 1))[y]);
+      return (const uint16_t *)(h + 1) + y * h->width;
+    }
+
+    /**
+     * @brief Decodes part of one row to 32 bit 0x00RRGGBB pixels.
+     * @return Returns the number of opaque pixels written.
+     * @param h The sprite header.
+     * @param y The row, 0 is the top.
+     * @param first The first column to decode.
+     * @param count The number of columns to decode.
+     * @param line The output, transparent pixels are left unchanged.
+     * @param mask If not nullptr receives 1 for each opaque pixel and 0 for each transparent one.
+     */
+    inline int32_t decodeRow(const header *h, int32_t y, int32_t first, int32_t count, uint32_t *line, uint8_t *mask)
+    {
+      const uint16_t *p = row(h, y);
+      int32_t opaque = 0;
+
+      if (!(h->flags & SPRITE_FLAG_RLE))
+      {
+        p += first;
+        if (!(h->flags & SPRITE_FLAG_TRANSPARENT))
+        {
+          pixel::fromRgb565(line, p, count);
+          for (int32_t i = 0; mask != nullptr && i < count; i++)
+            mask[i] = 1;
+          return count;
+        }
+        for (int32_t i = 0; i < count; i++)
+        {
+          bool on = p[i] != h->key;
+          if (on)
+            pixel::scalar::fromRgb565(line + i, p + i, 1);
+          if (mask != nullptr)
+            mask[i] = on;
+          opaque += on;
+        }
+        return opaque;
+      }
+
+      // walk packets up to the first column, then decode the part that overlaps
+      const int32_t end = first + count;
+      for (int32_t x = 0; x < end;)
+      {
+        uint16_t op = *p & SPRITE_OP_MASK;
+        int32_t n = *p++ & SPRITE_MAX_RUN;
+        if (n == 0)
+          break;
+
+        int32_t a = x > first ? x : first;
+        int32_t b = x + n < end ? x + n : end;
+        int32_t len = b - a;
+
+        if (op == SPRITE_OP_SKIP)
+        {
+          for (int32_t i = 0; mask != nullptr && i < len; i++)
+            mask[a - first + i] = 0;
+        }
+        else if (op == SPRITE_OP_REPEAT)
+        {
+          if (len > 0)
+          {
+            uint32_t rgb;
+            pixel::scalar::fromRgb565(&rgb, p, 1);
+            for (int32_t i = 0; i < len; i++)
+              line[a - first + i] = rgb;
+            for (int32_t i = 0; mask != nullptr && i < len; i++)
+              mask[a - first + i] = 1;
+            opaque += len;
+          }
+          p++;
+        }
+        else
+        {
+          if (len > 0)
+          {
+            pixel::fromRgb565(line + a - first, p + a - x, len);
+            for (int32_t i = 0; mask != nullptr && i < len; i++)
+              mask[a - first + i] = 1;
+            opaque += len;
+          }
+          p += n;
+        }
+        x += n;
+      }
+      return opaque;
+    }
+  };
+};
+
+#endif // VEX_SPRITEFORMAT_H
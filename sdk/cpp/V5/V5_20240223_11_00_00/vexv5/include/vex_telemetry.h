@@ -0,0 +1,274 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_telemetry.h                                             */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_TELEMETRY_CLASS_H
+#define VEX_TELEMETRY_CLASS_H
+
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_telemetry.h
+ * @brief   Binary telemetry writer class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief telemetry class                                                     */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define TELEMETRY_KEY_INTERVAL 100
+#define TELEMETRY_MAX_VALUE 4e18 // largest stored integer, the delta of two still fits an int64_t
+
+  /**
+   * @brief Use the telemetry class to log numbers in a compact binary form instead of text.
+   * @details
+   *  Fields are declared once, then each log() or logValues() call writes
+   *  one record of varints, see vex_telemetryformat.h, through an sdlogger.
+   *  Nothing is formatted as text on the brain, a typical record is a few
+   *  bytes where the same line of CSV is tens.  Every record carries a uS
+   *  timestamp from vexSystemHighResTimeGet.  A key record with absolute
+   *  values is written every TELEMETRY_KEY_INTERVAL records and after the
+   *  logger drops one, so a decoder never applies a delta to a value it did
+   *  not see.
+   *  Int and fixed values are clamped to TELEMETRY_MAX_VALUE once scaled,
+   *  NaN is stored as 0.
+   *  tools/host/telemetry2csv turns the file into CSV or column files.
+   *
+   * @code
+   *  sdlogger log("drive.tlm");
+   *  telemetry tlm(log);
+   *  tlm.addFixed("speed", 0.01);
+   *  tlm.addInt("state");
+   *
+   *  tlm.log(leftMotor.velocity(rpm), state);
+   * @endcode
+   */
+  class telemetry
+  {
+  public:
+    /**
+     * @brief Creates a new telemetry writer.
+     * @param log The logger records are written to.
+     */
+    telemetry(sdlogger &log) : _log(log)
+    {
+      _fieldCount = 0;
+      _schemaWritten = false;
+      _needKey = true;
+      _sinceKey = 0;
+      _droppedSinceKey = 0;
+      _prevTime = 0;
+      _records = 0;
+      _dropped = 0;
+      _bytes = 0;
+      for (int32_t i = 0; i < TELEMETRY_MAX_FIELDS; i++)
+      {
+        _prev[i] = 0;
+        _last[i] = 0;
+      }
+    }
+    ~telemetry() {};
+
+    telemetry(const telemetry &) = delete;
+    telemetry &operator=(const telemetry &) = delete;
+
+    /**
+     * @brief Adds an integer field.
+     * @return Returns the field index, or -1 if no more fields can be added.
+     * @param name The field name, at most TELEMETRY_MAX_NAME characters are kept.
+     */
+    int32_t addInt(const char *name)
+    {
+      return _add(name, telemetryformat::tFieldType::kFieldTypeInt, 1);
+    }
+
+    /**
+     * @brief Adds a fixed point field, values are stored as whole steps of the resolution.
+     * @return Returns the field index, or -1 if no more fields can be added.
+     * @param name The field name, at most TELEMETRY_MAX_NAME characters are kept.
+     * @param resolution The smallest change kept, for example 0.01.
+     */
+    int32_t addFixed(const char *name, double resolution)
+    {
+      return resolution > 0 ? _add(name, telemetryformat::tFieldType::kFieldTypeFixed, resolution) : -1;
+    }
+
+    /**
+     * @brief Adds a float field, values are stored whole as 4 bytes.
+     * @return Returns the field index, or -1 if no more fields can be added.
+     * @param name The field name, at most TELEMETRY_MAX_NAME characters are kept.
+     */
+    int32_t addFloat(const char *name)
+    {
+      return _add(name, telemetryformat::tFieldType::kFieldTypeFloat, 1);
+    }
+
+    /**
+     * @brief Writes one record.
+     * @return Returns true if the logger accepted the record.
+     * @param values Pointer to one value per field, in the order the fields were added.
+     */
+    bool logValues(const double *values)
+    {
+      if (_fieldCount == 0 || (!_schemaWritten && !_writeSchema()))
+        return _drop();
+
+      uint8_t buf[1 + 10 + 10 + TELEMETRY_MAX_FIELDS * 10 + 2];
+      int64_t cur[TELEMETRY_MAX_FIELDS];
+      uint64_t now = vexSystemHighResTimeGet();
+      bool key = _needKey || _sinceKey >= TELEMETRY_KEY_INTERVAL;
+
+      uint32_t n = 0;
+      buf[n++] = key ? TELEMETRY_TAG_KEY : TELEMETRY_TAG_DELTA;
+      if (key)
+      {
+        n += telemetryformat::putVarint(buf + n, now);
+        n += telemetryformat::putVarint(buf + n, _droppedSinceKey);
+      }
+      else
+        n += telemetryformat::putVarint(buf + n, now - _prevTime);
+
+      for (int32_t i = 0; i < _fieldCount; i++)
+      {
+        if (_fields[i].type == telemetryformat::tFieldType::kFieldTypeFloat)
+        {
+          n += telemetryformat::putFloat(buf + n, (float)values[i]);
+          cur[i] = 0;
+          continue;
+        }
+        double v = values[i] * _fields[i].scale;
+        if (v > TELEMETRY_MAX_VALUE)
+          v = TELEMETRY_MAX_VALUE;
+        else if (v < -TELEMETRY_MAX_VALUE)
+          v = -TELEMETRY_MAX_VALUE;
+        cur[i] = v != v ? 0 : (int64_t)(v < 0 ? v - 0.5 : v + 0.5);
+        n += telemetryformat::putVarint(buf + n, telemetryformat::zigzag(key ? cur[i] : cur[i] - _prev[i]));
+      }
+
+      // a decoder only resynchronizes on a key record with a matching CRC
+      uint16_t crc = telemetryformat::crc16(buf, n);
+      buf[n++] = (uint8_t)crc;
+      if (key)
+        buf[n++] = (uint8_t)(crc >> 8);
+
+      if (!_log.write(buf, n))
+        return _drop();
+
+      memcpy(_prev, cur, sizeof(int64_t) * _fieldCount);
+      memcpy(_last, values, sizeof(double) * _fieldCount);
+      _prevTime = now;
+      if (key)
+      {
+        _needKey = false;
+        _sinceKey = 0;
+        _droppedSinceKey = 0;
+      }
+      _sinceKey++;
+      _records++;
+      _bytes += n;
+      return true;
+    }
+
+    /**
+     * @brief Writes one record, fields without a value repeat their last value.
+     * @return Returns true if the logger accepted the record.
+     * @param v0 The value of field 0.
+     * @param rest The values of the following fields.
+     */
+    template <class... T>
+    bool log(double v0, T... rest)
+    {
+      double values[TELEMETRY_MAX_FIELDS] = {v0, (double)rest...};
+      for (int32_t i = 1 + sizeof...(rest); i < _fieldCount; i++)
+        values[i] = _last[i];
+      return logValues(values);
+    }
+
+    int32_t fields() const { return _fieldCount; }
+    uint32_t records() const { return _records; }
+    uint32_t dropped() const { return _dropped; }
+    uint32_t bytes() const { return _bytes; }
+
+  private:
+    struct _field
+    {
+      telemetryformat::tFieldType type;
+      float resolution;
+      double scale; // 1 / resolution
+      char name[TELEMETRY_MAX_NAME + 1];
+    };
+
+    sdlogger &_log;
+    _field _fields[TELEMETRY_MAX_FIELDS];
+    int32_t _fieldCount;
+    bool _schemaWritten;
+    bool _needKey;
+    uint32_t _sinceKey;
+    uint32_t _droppedSinceKey;
+    uint64_t _prevTime;
+    int64_t _prev[TELEMETRY_MAX_FIELDS]; // stored values of the last record
+    double _last[TELEMETRY_MAX_FIELDS];  // values passed to the last record
+    uint32_t _records;
+    uint32_t _dropped;
+    uint32_t _bytes;
+
+    int32_t _add(const char *name, telemetryformat::tFieldType type, double resolution)
+    {
+      // the schema is fixed once it is in the file
+      if (_schemaWritten || _fieldCount >= TELEMETRY_MAX_FIELDS || name == nullptr)
+        return -1;
+      _field &f = _fields[_fieldCount];
+      f.type = type;
+      f.resolution = (float)resolution;
+      f.scale = 1.0 / f.resolution;
+      strncpy(f.name, name, TELEMETRY_MAX_NAME);
+      f.name[TELEMETRY_MAX_NAME] = 0;
+      return _fieldCount++;
+    }
+
+    bool _writeSchema()
+    {
+      uint8_t buf[7 + TELEMETRY_MAX_FIELDS * (6 + TELEMETRY_MAX_NAME)];
+      uint32_t n = 0;
+      buf[n++] = TELEMETRY_TAG_SCHEMA;
+      buf[n++] = (uint8_t)TELEMETRY_MAGIC;
+      buf[n++] = (uint8_t)(TELEMETRY_MAGIC >> 8);
+      buf[n++] = (uint8_t)(TELEMETRY_MAGIC >> 16);
+      buf[n++] = (uint8_t)(TELEMETRY_MAGIC >> 24);
+      buf[n++] = TELEMETRY_VERSION;
+      buf[n++] = _fieldCount;
+      for (int32_t i = 0; i < _fieldCount; i++)
+      {
+        buf[n++] = (uint8_t)_fields[i].type;
+        n += telemetryformat::putFloat(buf + n, _fields[i].resolution);
+        uint32_t len = strlen(_fields[i].name);
+        buf[n++] = len;
+        memcpy(buf + n, _fields[i].name, len);
+        n += len;
+      }
+      _schemaWritten = _log.write(buf, n);
+      if (_schemaWritten)
+        _bytes += n;
+      return _schemaWritten;
+    }
+
+    bool _drop()
+    {
+      _dropped++;
+      _droppedSinceKey++;
+      _needKey = true;
+      return false;
+    }
+  };
+};
+
+#endif // VEX_TELEMETRY_CLASS_H
@@ -0,0 +1,123 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_telemetryformat.h                                       */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_TELEMETRYFORMAT_H
+#define VEX_TELEMETRYFORMAT_H
+
+#include <stdint.h>
+
+#include "vex_varint.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_telemetryformat.h
+ * @brief   Binary telemetry log format
+ * @details
+ *  A telemetry log is a sequence of blocks, each starting with a tag byte.
+ *
+ *    TELEMETRY_TAG_SCHEMA  magic uint32_t, version, field count, then for
+ *                          each field its type, resolution as a float and
+ *                          name as a length and that many characters
+ *    TELEMETRY_TAG_KEY     time in uS, records dropped since the last key
+ *                          record, then every field as an absolute value,
+ *                          then the CRC-16 of the record as a uint16_t
+ *    TELEMETRY_TAG_DELTA   time since the last record in uS, then every
+ *                          field as the difference to the last record,
+ *                          then the low byte of the CRC-16 of the record
+ *
+ *  Unsigned values are LEB128 varints, signed values are zigzag varints,
+ *  floats are 4 little endian bytes.  Integer and fixed point fields are
+ *  delta coded in delta records, float fields are always stored whole.  A
+ *  fixed point field holds round(value / resolution).  The CRC covers the
+ *  record from its tag on.  A file may hold several schema blocks, for
+ *  example when a log is appended to, every record uses the last schema
+ *  before it.
+ *  After damaged data a decoder only starts again at a schema block or at a
+ *  key record whose CRC matches, delta records are only applied after a key
+ *  record and while their CRC matches.
+ *  tools/host/telemetry2csv.cpp decodes logs with it.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace telemetryformat
+  {
+    using varint::putVarint;
+    using varint::getVarint;
+    using varint::zigzag;
+    using varint::unzigzag;
+
+#define TELEMETRY_MAGIC 0x4C543556 // "V5TL"
+#define TELEMETRY_VERSION 2
+#define TELEMETRY_MAX_FIELDS 32
+#define TELEMETRY_MAX_NAME 15
+
+#define TELEMETRY_TAG_SCHEMA 0xF5
+#define TELEMETRY_TAG_KEY 0x02
+#define TELEMETRY_TAG_DELTA 0x01
+
+    enum class tFieldType
+    {
+      kFieldTypeInt = 0,
+      kFieldTypeFixed,
+      kFieldTypeFloat
+    };
+
+    /**
+     * @brief Computes the CRC-16/CCITT-FALSE of a record.
+     * @return Returns the CRC.
+     * @param p The record, starting at its tag.
+     * @param len The number of bytes.
+     */
+    inline uint16_t crc16(const uint8_t *p, uint32_t len)
+    {
+      uint16_t crc = 0xFFFF;
+      for (uint32_t i = 0; i < len; i++)
+      {
+        crc ^= (uint16_t)(p[i] << 8);
+        for (int b = 0; b < 8; b++)
+          crc = crc & 0x8000 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+      }
+      return crc;
+    }
+
+    /**
+     * @brief Writes a float as 4 little endian bytes.
+     * @return Returns 4.
+     */
+    inline uint32_t putFloat(uint8_t *p, float f)
+    {
+      uint32_t u;
+      __builtin_memcpy(&u, &f, 4);
+      p[0] = u;
+      p[1] = u >> 8;
+      p[2] = u >> 16;
+      p[3] = u >> 24;
+      return 4;
+    }
+
+    /**
+     * @brief Reads a float stored by putFloat.
+     * @return Returns false if the input ends first.
+     */
+    inline bool getFloat(const uint8_t *&p, const uint8_t *end, float &f)
+    {
+      if (end - p < 4)
+        return false;
+      uint32_t u = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+      __builtin_memcpy(&f, &u, 4);
+      p += 4;
+      return true;
+    }
+  };
+};
+
+#endif // VEX_TELEMETRYFORMAT_H
@@ -0,0 +1,262 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_textcache.h                                             */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_TEXTCACHE_CLASS_H
+#define VEX_TEXTCACHE_CLASS_H
+
+#include <cstdarg>
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_textcache.h
+ * @brief   Text measurement and redraw cache class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief text cache class                                                    */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define TEXTCACHE_MAX_SLOTS 32
+#define TEXTCACHE_MAX_MEASURE 64
+#define TEXTCACHE_MAX_LENGTH 80
+
+  /**
+   * @brief Use the textcache class to redraw text only when it changes.
+   * @details
+   *  printAt() remembers the last string, font and colors drawn at each
+   *  position and returns without touching the screen when nothing changed,
+   *  so a debug screen can call it every frame.  When a string gets shorter it
+   *  is padded with spaces, drawn opaque, so the old text is erased without a
+   *  separate clear.  getStringWidth() and getStringHeight() results are kept
+   *  per font and string.
+   *  Glyphs are rasterized by VEXos and cannot be read back, so caching the
+   *  layout and skipping unchanged draws is where the time is saved.
+   *  The lcd font is left set to the font of the last call.
+   */
+  class textcache
+  {
+  public:
+    /**
+     * @brief Creates a new text cache.
+     * @param screen The screen text is drawn on.
+     */
+    textcache(brain::lcd &screen) : _screen(screen)
+    {
+      clear();
+    }
+    ~textcache() {};
+
+    textcache(const textcache &) = delete;
+    textcache &operator=(const textcache &) = delete;
+
+    /**
+     * @brief Prints a formatted string at a position if it differs from what was last printed there.
+     * @return Returns true if the screen was drawn.
+     * @param x The x-coordinate at which the text starts.
+     * @param y The y-coordinate at which the text starts.
+     * @param font The font to use.
+     * @param format A format string, as for lcd::printAt.
+     */
+    bool printAt(int32_t x, int32_t y, fontType font, const char *format, ...)
+    {
+      char buf[TEXTCACHE_MAX_LENGTH + 1];
+      va_list args;
+      va_start(args, format);
+      vex_vsnprintf(buf, sizeof(buf), format, args);
+      va_end(args);
+
+      uint32_t fg = vexDisplayForegroundColorGet();
+      uint32_t bg = vexDisplayBackgroundColorGet();
+
+      _slot *s = _findSlot(x, y);
+      if (s->used && s->font == font && s->fg == fg && s->bg == bg && strcmp(s->text, buf) == 0)
+      {
+        s->stamp = ++_clock;
+        _skipped++;
+        return false;
+      }
+
+      int32_t width = getStringWidth(font, buf);
+
+      // pad with spaces to cover the end of a longer previous string
+      int32_t textLen = strlen(buf);
+      int32_t len = textLen;
+      if (s->used && s->width > width)
+      {
+        int32_t space = getStringWidth(font, " ");
+        for (int32_t w = width; w < s->width && len < TEXTCACHE_MAX_LENGTH && space > 0; w += space)
+          buf[len++] = ' ';
+        buf[len] = 0;
+      }
+
+      _screen.setFont(font);
+      _screen.printAt(x, y, true, "%s", buf);
+      _drawn++;
+
+      s->used = true;
+      s->x = x;
+      s->y = y;
+      s->font = font;
+      s->fg = fg;
+      s->bg = bg;
+      s->width = width;
+      s->stamp = ++_clock;
+      buf[textLen] = 0;
+      memcpy(s->text, buf, textLen + 1);
+      return true;
+    }
+
+    /**
+     * @brief Gets the width of a string, measuring it only the first time.
+     * @return Returns the width in pixels.
+     * @param font The font to use.
+     * @param cstr The string to measure.
+     */
+    int32_t getStringWidth(fontType font, const char *cstr)
+    {
+      _measure *m = _measureString(font, cstr);
+      return m != nullptr ? m->width : _measureWidth(font, cstr);
+    }
+
+    /**
+     * @brief Gets the height of a string, measuring it only the first time.
+     * @return Returns the height in pixels.
+     * @param font The font to use.
+     * @param cstr The string to measure.
+     */
+    int32_t getStringHeight(fontType font, const char *cstr)
+    {
+      _measure *m = _measureString(font, cstr);
+      if (m != nullptr)
+        return m->height;
+      _screen.setFont(font);
+      return _screen.getStringHeight(cstr);
+    }
+
+    /**
+     * @brief Forgets what was printed at a position so the next printAt draws.
+     * @param x The x-coordinate used with printAt.
+     * @param y The y-coordinate used with printAt.
+     */
+    void invalidate(int32_t x, int32_t y)
+    {
+      for (_slot &s : _slots)
+        if (s.used && s.x == x && s.y == y)
+          s.used = false;
+    }
+
+    /**
+     * @brief Forgets everything, call this after the screen is cleared.
+     */
+    void invalidateAll()
+    {
+      for (_slot &s : _slots)
+        s.used = false;
+    }
+
+    /**
+     * @brief Forgets everything including the measurements.
+     */
+    void clear()
+    {
+      invalidateAll();
+      for (_measure &m : _measures)
+        m.used = false;
+      _clock = 0;
+      _drawn = 0;
+      _skipped = 0;
+    }
+
+    uint32_t drawn() const { return _drawn; }
+    uint32_t skipped() const { return _skipped; }
+
+  private:
+    struct _slot
+    {
+      bool used;
+      int32_t x;
+      int32_t y;
+      fontType font;
+      uint32_t fg;
+      uint32_t bg;
+      int32_t width;
+      uint32_t stamp;
+      char text[TEXTCACHE_MAX_LENGTH + 1];
+    };
+
+    struct _measure
+    {
+      bool used;
+      fontType font;
+      int32_t width;
+      int32_t height;
+      char text[TEXTCACHE_MAX_LENGTH + 1];
+    };
+
+    brain::lcd &_screen;
+    _slot _slots[TEXTCACHE_MAX_SLOTS];
+    _measure _measures[TEXTCACHE_MAX_MEASURE];
+    uint32_t _clock;
+    uint32_t _drawn;
+    uint32_t _skipped;
+
+    // slot for a position, reusing the least recently printed one when full
+    _slot *_findSlot(int32_t x, int32_t y)
+    {
+      _slot *oldest = &_slots[0];
+      for (_slot &s : _slots)
+      {
+        if (s.used && s.x == x && s.y == y)
+          return &s;
+        if (!s.used)
+          oldest = &s;
+        else if (oldest->used && s.stamp < oldest->stamp)
+          oldest = &s;
+      }
+      oldest->used = false;
+      return oldest;
+    }
+
+    int32_t _measureWidth(fontType font, const char *cstr)
+    {
+      _screen.setFont(font);
+      return _screen.getStringWidth(cstr);
+    }
+
+    // direct mapped on an FNV-1a hash of font and text, strings too long to keep are not cached
+    _measure *_measureString(fontType font, const char *cstr)
+    {
+      uint32_t len = strlen(cstr);
+      if (len > TEXTCACHE_MAX_LENGTH)
+        return nullptr;
+
+      uint32_t h = 2166136261u ^ (uint32_t)font;
+      for (uint32_t i = 0; i < len; i++)
+        h = (h ^ (uint8_t)cstr[i]) * 16777619u;
+
+      _measure &m = _measures[h % TEXTCACHE_MAX_MEASURE];
+      if (m.used && m.font == font && strcmp(m.text, cstr) == 0)
+        return &m;
+
+      _screen.setFont(font);
+      m.used = true;
+      m.font = font;
+      m.width = _screen.getStringWidth(cstr);
+      m.height = _screen.getStringHeight(cstr);
+      memcpy(m.text, cstr, len + 1);
+      return &m;
+    }
+  };
+};
+
+#endif // VEX_TEXTCACHE_CLASS_H
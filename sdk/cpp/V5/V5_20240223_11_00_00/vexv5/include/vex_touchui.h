@@ -0,0 +1,573 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_touchui.h                                               */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_TOUCHUI_CLASS_H
+#define VEX_TOUCHUI_CLASS_H
+
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_touchui.h
+ * @brief   Immediate mode touch user interface class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief touch user interface class                                          */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define TOUCHUI_MAX_WIDGETS 64
+#define TOUCHUI_GRID_COLUMNS 8
+#define TOUCHUI_GRID_ROWS 4
+#define TOUCHUI_MAX_ID_DEPTH 4
+#define TOUCHUI_MAX_LABEL 63
+
+  /**
+   * @brief Use the touchui class to build touch screen menus such as an autonomous selector.
+   * @details
+   *  Widgets are declared every frame between begin() and end() and return
+   *  true when the user changed them, there are no widget objects to keep.
+   *  Each widget is drawn only when its label, value or pressed state differs
+   *  from what is on the screen, so calling the frame in a loop costs almost
+   *  nothing while nobody touches the screen.  A widget that moves or is no
+   *  longer declared is cleared to the style background, widgets it
+   *  overlapped are drawn again on the next frame.
+   *  The touch is read once per frame.  end() indexes the widget rectangles in
+   *  a coarse grid, the next press only tests the widgets in the grid cell
+   *  under it.  Coordinates are in screen pixels, the lcd origin is not applied.
+   *  A widget is identified by its kind, its label and the ids pushed with
+   *  pushId().  Widgets with the same label, such as a "Reset" button for
+   *  each side, either get "##" and an id after the label, only the text
+   *  before it is drawn, or are declared between pushId() and popId().
+   *
+   * @code
+   *  touchui ui;
+   *  int32_t auton = 0;
+   *  const char *names[] = {"Left", "Right", "Skills"};
+   *  bool confirmed = false;
+   *
+   *  while (!confirmed) {
+   *    ui.begin();
+   *    ui.tabs({0, 0, 480, 40}, names, 3, auton);
+   *    if (ui.button("Reset##left", {10, 190, 100, 40}))
+   *      resetLeft();
+   *    if (ui.button("Reset##right", {120, 190, 100, 40}))
+   *      resetRight();
+   *    confirmed = ui.button("Confirm", {340, 190, 130, 40});
+   *    ui.end();
+   *    task::sleep(20);
+   *  }
+   * @endcode
+   */
+  class touchui
+  {
+  public:
+    /**
+     * @brief Colors used to draw widgets.
+     */
+    struct style
+    {
+      uint32_t background;
+      uint32_t face;
+      uint32_t pressed;
+      uint32_t border;
+      uint32_t text;
+      uint32_t accent;
+    };
+
+    touchui()
+    {
+      _style = {0x000000, 0x303030, 0x606060, 0x808080, 0xFFFFFF, 0x0080FF};
+      _frame = 0;
+      _active = -1;
+      _down = false;
+      _wasDown = false;
+      _x = 0;
+      _y = 0;
+      _seq = 0;
+      _depth = 0;
+      _scope = 0;
+      for (_widget &w : _widgets)
+        w.used = false;
+      _rebuildIndex();
+    }
+    ~touchui() {};
+
+    void setStyle(const style &s)
+    {
+      _style = s;
+      invalidate();
+    }
+    const style &getStyle() const { return _style; }
+
+    /**
+     * @brief Starts a frame, reads the touch screen.
+     */
+    void begin()
+    {
+      _frame++;
+      _seq = 0;
+      _depth = 0;
+      _scope = 0;
+      _fg = vexDisplayForegroundColorGet();
+      _bg = vexDisplayBackgroundColorGet();
+
+      V5_TouchStatus status;
+      vexTouchDataGet(&status);
+      _wasDown = _down;
+      _down = status.lastEvent != kTouchEventRelease;
+      _x = status.lastXpos;
+      _y = status.lastYpos;
+
+      // a new press captures the widget under it until release
+      if (_down && !_wasDown)
+        _active = _hitTest(_x, _y);
+    }
+
+    /**
+     * @brief Ends a frame, erases widgets that were not declared and indexes the rest.
+     */
+    void end()
+    {
+      for (_widget &w : _widgets)
+      {
+        if (w.used && w.frame != _frame)
+        {
+          w.used = false;
+          _erase(w.r);
+        }
+      }
+      _rebuildIndex();
+
+      if (!_down)
+        _active = -1;
+
+      vexDisplayForegroundColor(_fg);
+      vexDisplayBackgroundColor(_bg);
+    }
+
+    /**
+     * @brief Starts an id scope, widgets declared until popId() are told apart from widgets outside it.
+     * @param id A name for the scope, such as the name of a list entry.
+     */
+    void pushId(const char *id)
+    {
+      _push(_hash(id, 0));
+    }
+
+    /**
+     * @brief Starts an id scope, widgets declared until popId() are told apart from widgets outside it.
+     * @param id A number for the scope, such as a loop index.
+     */
+    void pushId(int32_t id)
+    {
+      _push(_mix(2166136261u, (uint32_t)id));
+    }
+
+    /**
+     * @brief Ends the scope started by the last pushId().
+     */
+    void popId()
+    {
+      if (_depth > 0)
+        _depth--;
+      _scope = _depth == 0 ? 0 : _scopes[(_depth < TOUCHUI_MAX_ID_DEPTH ? _depth : TOUCHUI_MAX_ID_DEPTH) - 1];
+    }
+
+    /**
+     * @brief Forces every widget to be drawn again on the next frame.
+     */
+    void invalidate()
+    {
+      for (_widget &w : _widgets)
+        w.drawn = 0;
+    }
+
+    /**
+     * @brief Clears the screen to the background color and forces every widget to be drawn again.
+     */
+    void clear()
+    {
+      vexDisplayForegroundColor(_style.background);
+      vexDisplayRectFill(0, 0, SYSTEM_DISPLAY_WIDTH - 1, SYSTEM_DISPLAY_HEIGHT - 1);
+      invalidate();
+    }
+
+    /**
+     * @brief Checks if the screen is being touched.
+     * @return Returns true while the screen is pressed.
+     */
+    bool touching() const { return _down; }
+
+    /**
+     * @brief A push button.
+     * @return Returns true when the button is released with the finger still on it.
+     * @param label The text on the button, also identifies the button, see "##" above.
+     * @param r The button area.
+     */
+    bool button(const char *label, const rect &r)
+    {
+      int32_t i = _declare(_hash(label, 1), r);
+      if (i < 0)
+        return false;
+      _widget &w = _widgets[i];
+
+      bool held = _active == i && _down && r.contains(_x, _y);
+      bool clicked = _active == i && !_down && _wasDown && r.contains(_x, _y);
+
+      if (_changed(w, _mix(_hash(label, 1), held)))
+        _drawButton(r, label, held ? _style.pressed : _style.face);
+
+      return clicked;
+    }
+
+    /**
+     * @brief A button that switches between on and off.
+     * @return Returns true when the value changed.
+     * @param label The text on the button, also identifies the button, see "##" above.
+     * @param r The button area.
+     * @param value The state, updated when the user taps the button.
+     */
+    bool toggle(const char *label, const rect &r, bool &value)
+    {
+      int32_t i = _declare(_hash(label, 2), r);
+      if (i < 0)
+        return false;
+      _widget &w = _widgets[i];
+
+      bool changed = false;
+      if (_active == i && !_down && _wasDown && r.contains(_x, _y))
+      {
+        value = !value;
+        changed = true;
+      }
+
+      if (_changed(w, _mix(_hash(label, 2), value)))
+        _drawButton(r, label, value ? _style.accent : _style.face);
+
+      return changed;
+    }
+
+    /**
+     * @brief A horizontal slider.
+     * @return Returns true when the value changed.
+     * @param label Identifies the slider, it is not drawn.
+     * @param r The slider area.
+     * @param value The value, updated while the user drags the slider.
+     * @param min The value at the left end.
+     * @param max The value at the right end.
+     */
+    bool slider(const char *label, const rect &r, double &value, double min, double max)
+    {
+      int32_t i = _declare(_hash(label, 3), r);
+      if (i < 0 || max <= min || r.width < 2)
+        return false;
+      _widget &w = _widgets[i];
+
+      bool changed = false;
+      if (_active == i && _down)
+      {
+        double v = min + (double)(_x - r.x) * (max - min) / (r.width - 1);
+        v = v < min ? min : v > max ? max : v;
+        changed = v != value;
+        value = v;
+      }
+
+      double clamped = value < min ? min : value > max ? max : value;
+      int32_t knob = r.x + (int32_t)((clamped - min) * (r.width - 1) / (max - min) + 0.5);
+      if (_changed(w, _mix(_mix(_hash(label, 3), knob), _active == i)))
+      {
+        int32_t mid = r.y + r.height / 2;
+        int32_t kx = knob - 4 < r.x ? r.x : knob + 5 > r.right() ? r.right() - 9 : knob - 4;
+        _fill(r, _style.background);
+        _fill({r.x, mid - 2, r.width, 4}, _style.face);
+        _fill({r.x, mid - 2, knob - r.x, 4}, _style.accent);
+        _fill({kx, r.y, 9, r.height}, _active == i ? _style.pressed : _style.text);
+      }
+
+      return changed;
+    }
+
+    /**
+     * @brief A vertical list with one selected row.
+     * @return Returns true when the selection changed.
+     * @param r The list area, rows that do not fit are not shown.
+     * @param items The text of each row.
+     * @param count The number of rows.
+     * @param selected The index of the selected row, updated when the user taps a row.
+     * @param rowHeight The height of each row in pixels.
+     */
+    bool list(const rect &r, const char *const *items, int32_t count, int32_t &selected, int32_t rowHeight = 30)
+    {
+      int32_t i = _declare(_hash(items, count, 4), r);
+      if (i < 0 || rowHeight <= 0)
+        return false;
+      _widget &w = _widgets[i];
+
+      bool changed = false;
+      if (_active == i && _down && !_wasDown)
+      {
+        int32_t row = (_y - r.y) / rowHeight;
+        if (row >= 0 && row < count && row != selected)
+        {
+          selected = row;
+          changed = true;
+        }
+      }
+
+      if (_changed(w, _mix(_hash(items, count, 4), selected)))
+      {
+        _fill(r, _style.background);
+        for (int32_t row = 0; row < count && (row + 1) * rowHeight <= r.height; row++)
+        {
+          rect cell = {r.x, r.y + row * rowHeight, r.width, rowHeight};
+          _drawButton(cell, items[row], row == selected ? _style.accent : _style.face);
+        }
+      }
+
+      return changed;
+    }
+
+    /**
+     * @brief A row of tabs with one active tab.
+     * @return Returns true when the active tab changed.
+     * @param r The area of the tab row.
+     * @param labels The text of each tab.
+     * @param count The number of tabs.
+     * @param active The index of the active tab, updated when the user taps a tab.
+     */
+    bool tabs(const rect &r, const char *const *labels, int32_t count, int32_t &active)
+    {
+      int32_t i = _declare(_hash(labels, count, 5), r);
+      if (i < 0 || count <= 0)
+        return false;
+      _widget &w = _widgets[i];
+
+      int32_t tabWidth = r.width / count;
+      bool changed = false;
+      if (_active == i && _down && !_wasDown && tabWidth > 0)
+      {
+        int32_t tab = (_x - r.x) / tabWidth;
+        if (tab >= 0 && tab < count && tab != active)
+        {
+          active = tab;
+          changed = true;
+        }
+      }
+
+      if (_changed(w, _mix(_hash(labels, count, 5), active)))
+      {
+        for (int32_t tab = 0; tab < count; tab++)
+        {
+          rect cell = {r.x + tab * tabWidth, r.y, tabWidth, r.height};
+          _drawButton(cell, labels[tab], tab == active ? _style.accent : _style.face);
+        }
+      }
+
+      return changed;
+    }
+
+  private:
+    struct _widget
+    {
+      bool used;
+      uint32_t id;
+      uint32_t frame;
+      uint32_t drawn; // hash of what is on the screen, 0 when unknown
+      uint32_t seq;   // declaration order, later widgets are on top
+      rect r;
+    };
+
+    style _style;
+    _widget _widgets[TOUCHUI_MAX_WIDGETS];
+    uint64_t _grid[TOUCHUI_GRID_ROWS][TOUCHUI_GRID_COLUMNS];
+    uint32_t _frame;
+    uint32_t _seq;
+    int32_t _active; // widget slot that owns the current press, -1 for none
+    bool _down;
+    bool _wasDown;
+    int32_t _x;
+    int32_t _y;
+    uint32_t _scopes[TOUCHUI_MAX_ID_DEPTH];
+    int32_t _depth;
+    uint32_t _scope; // hash of the pushed ids, 0 outside any scope
+    uint32_t _fg;
+    uint32_t _bg;
+
+    // FNV-1a
+    static uint32_t _mix(uint32_t h, uint32_t v)
+    {
+      for (int32_t i = 0; i < 4; i++, v >>= 8)
+        h = (h ^ (v & 0xFF)) * 16777619u;
+      return h ? h : 1;
+    }
+
+    static uint32_t _hash(const char *s, uint32_t kind)
+    {
+      uint32_t h = _mix(2166136261u, kind);
+      while (s != nullptr && *s)
+        h = (h ^ (uint8_t)*s++) * 16777619u;
+      return h;
+    }
+
+    static uint32_t _hash(const char *const *s, int32_t count, uint32_t kind)
+    {
+      uint32_t h = _mix(2166136261u, kind);
+      for (int32_t i = 0; i < count; i++)
+        h = _mix(h, _hash(s[i], kind));
+      return h;
+    }
+
+    // scopes deeper than TOUCHUI_MAX_ID_DEPTH are counted but use the id of the deepest one
+    void _push(uint32_t id)
+    {
+      if (_depth < TOUCHUI_MAX_ID_DEPTH)
+        _scope = _scopes[_depth] = _mix(_scope, id);
+      _depth++;
+    }
+
+    // finds or adds the slot for a widget, open addressing on the id, a slot
+    // already declared this frame is not given to a second widget
+    int32_t _declare(uint32_t id, const rect &r)
+    {
+      id = _mix(id, _scope);
+      int32_t slot = -1;
+      for (int32_t n = 0; n < TOUCHUI_MAX_WIDGETS; n++)
+      {
+        int32_t i = (id + n) % TOUCHUI_MAX_WIDGETS;
+        _widget &w = _widgets[i];
+        if (w.used && w.id == id && w.frame != _frame)
+        {
+          if (w.r.x != r.x || w.r.y != r.y || w.r.width != r.width || w.r.height != r.height)
+            _erase(w.r);
+          w.r = r;
+          w.frame = _frame;
+          w.seq = _seq++;
+          return i;
+        }
+        if (!w.used && slot < 0)
+          slot = i;
+      }
+      if (slot < 0)
+        return -1;
+
+      _widget &w = _widgets[slot];
+      w.used = true;
+      w.id = id;
+      w.r = r;
+      w.frame = _frame;
+      w.seq = _seq++;
+      w.drawn = 0;
+      return slot;
+    }
+
+    bool _changed(_widget &w, uint32_t look)
+    {
+      if (w.drawn == look)
+        return false;
+      w.drawn = look;
+      return true;
+    }
+
+    void _rebuildIndex()
+    {
+      const int32_t cw = SYSTEM_DISPLAY_WIDTH / TOUCHUI_GRID_COLUMNS;
+      const int32_t ch = SYSTEM_DISPLAY_HEIGHT / TOUCHUI_GRID_ROWS;
+
+      for (int32_t row = 0; row < TOUCHUI_GRID_ROWS; row++)
+        for (int32_t col = 0; col < TOUCHUI_GRID_COLUMNS; col++)
+          _grid[row][col] = 0;
+
+      for (int32_t i = 0; i < TOUCHUI_MAX_WIDGETS; i++)
+      {
+        const _widget &w = _widgets[i];
+        if (!w.used || w.r.empty())
+          continue;
+        int32_t c0 = _clamp(w.r.x / cw, TOUCHUI_GRID_COLUMNS);
+        int32_t c1 = _clamp((w.r.right() - 1) / cw, TOUCHUI_GRID_COLUMNS);
+        int32_t r0 = _clamp(w.r.y / ch, TOUCHUI_GRID_ROWS);
+        int32_t r1 = _clamp((w.r.bottom() - 1) / ch, TOUCHUI_GRID_ROWS);
+        for (int32_t row = r0; row <= r1; row++)
+          for (int32_t col = c0; col <= c1; col++)
+            _grid[row][col] |= 1ULL << i;
+      }
+    }
+
+    static int32_t _clamp(int32_t v, int32_t n)
+    {
+      return v < 0 ? 0 : v >= n ? n - 1 : v;
+    }
+
+    int32_t _hitTest(int32_t x, int32_t y)
+    {
+      if (x < 0 || y < 0 || x >= SYSTEM_DISPLAY_WIDTH || y >= SYSTEM_DISPLAY_HEIGHT)
+        return -1;
+
+      int32_t best = -1;
+      uint64_t mask = _grid[y * TOUCHUI_GRID_ROWS / SYSTEM_DISPLAY_HEIGHT][x * TOUCHUI_GRID_COLUMNS / SYSTEM_DISPLAY_WIDTH];
+      for (; mask != 0; mask &= mask - 1)
+      {
+        int32_t i = __builtin_ctzll(mask);
+        if (_widgets[i].r.contains(x, y) && (best < 0 || _widgets[i].seq > _widgets[best].seq))
+          best = i;
+      }
+      return best;
+    }
+
+    void _fill(const rect &r, uint32_t rgb)
+    {
+      if (r.empty())
+        return;
+      vexDisplayForegroundColor(rgb);
+      vexDisplayRectFill(r.x, r.y, r.right() - 1, r.bottom() - 1);
+    }
+
+    // clears where a widget was, the widgets over it are drawn again
+    void _erase(const rect &r)
+    {
+      _fill(r, _style.background);
+      for (_widget &w : _widgets)
+        if (w.used && w.r.intersects(r))
+          w.drawn = 0;
+    }
+
+    void _drawButton(const rect &r, const char *label, uint32_t face)
+    {
+      _fill(r, face);
+      vexDisplayForegroundColor(_style.border);
+      vexDisplayRectDraw(r.x, r.y, r.right() - 1, r.bottom() - 1);
+
+      // only the text before "##" is drawn
+      char text[TOUCHUI_MAX_LABEL + 1];
+      const char *id = label != nullptr ? strstr(label, "##") : nullptr;
+      if (id != nullptr)
+      {
+        size_t len = id - label;
+        if (len > TOUCHUI_MAX_LABEL)
+          len = TOUCHUI_MAX_LABEL;
+        memcpy(text, label, len);
+        text[len] = 0;
+        label = text;
+      }
+
+      if (label == nullptr || *label == 0)
+        return;
+      int32_t tw = vexDisplayStringWidthGet(label);
+      int32_t th = vexDisplayStringHeightGet(label);
+      vexDisplayForegroundColor(_style.text);
+      vexDisplayBackgroundColor(face);
+      vexDisplayPrintf(r.x + (r.width - tw) / 2, r.y + (r.height - th) / 2, 1, "%s", label);
+    }
+  };
+};
+
+#endif // VEX_TOUCHUI_CLASS_H
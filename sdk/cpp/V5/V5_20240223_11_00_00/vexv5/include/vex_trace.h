@@ -0,0 +1,553 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_trace.h                                                 */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_TRACE_CLASS_H
+#define VEX_TRACE_CLASS_H
+
+#include <cstring>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_trace.h
+ * @brief   Scope tracing class header
+ */
+/*---------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @brief trace class                                                         */
+/*-----------------------------------------------------------------------------*/
+namespace vex
+{
+#define TRACE_MAX_THREADS 8
+#define TRACE_RING_SIZE 512 // events per thread, a power of two
+#define TRACE_BLOCK_SIZE 1024
+#define TRACE_MAX_NAMES 64 // names in one block
+#define TRACE_FLUSH_INTERVAL 20
+#define TRACE_SERIAL_WAIT 100
+
+#define VEX_TRACE_JOIN2(a, b) a##b
+#define VEX_TRACE_JOIN(a, b) VEX_TRACE_JOIN2(a, b)
+
+/**
+ * @brief Traces the rest of the enclosing scope under a name, a string literal.
+ */
+#define VEX_TRACE_SCOPE(name) vex::tracescope VEX_TRACE_JOIN(_traceScope, __LINE__)(name)
+
+/**
+ * @brief Marks a moment under a name, a string literal.
+ */
+#define VEX_TRACE_MARK(name) vex::trace::mark(name)
+
+  /**
+   * @brief Use the trace class to see when each task runs which part of the code.
+   * @details
+   *  VEX_TRACE_SCOPE stores a begin event with a uS timestamp from
+   *  vexSystemHighResTimeGet and the end event when the scope is left.  Each
+   *  task that traces gets its own ring of TRACE_RING_SIZE events, only that
+   *  task adds to it and only the trace writer task takes from it, so no
+   *  lock is needed and a task is never blocked.  Storing an event copies
+   *  the name pointer, names must be string literals or otherwise outlive
+   *  the trace.
+   *  Every TRACE_FLUSH_INTERVAL mS the writer task merges the rings in time
+   *  order into vex_traceformat.h blocks and writes them to an sdlogger, or
+   *  to the USB serial port when there is none.  A begin that would not
+   *  leave room in the ring for the end of every open scope is not stored
+   *  and counted, its end is skipped too, so scopes in a trace always pair.
+   *  Scopes still open when the trace stops are ended at that time.
+   *  The first TRACE_MAX_THREADS tasks to trace get a ring, events from
+   *  later tasks are counted in dropped().
+   *  While no trace is running a scope costs a test.
+   *  tools/host/trace2json turns the file into the Chrome trace event
+   *  format, for chrome://tracing or ui.perfetto.dev.  Over serial capture
+   *  the port to a file, blocks mixed with other output are skipped.
+   *
+   * @code
+   *  sdlogger log("match.trc", false);
+   *  trace tracer(log);
+   *
+   *  int visionTask() {
+   *    trace::threadName("vision");
+   *    while (true) {
+   *      VEX_TRACE_SCOPE("vision");
+   *      ...
+   *    }
+   *  }
+   * @endcode
+   */
+  class trace
+  {
+  public:
+    /**
+     * @brief Creates a trace written to a log, nothing is recorded until start().
+     * @param log The logger blocks are written to, it is started by start() if needed.
+     * @param priority The priority of the writer task.
+     */
+    trace(sdlogger &log, int32_t priority = task::taskPrioritylow) : trace(priority)
+    {
+      _log = &log;
+    }
+
+    /**
+     * @brief Creates a trace written to the USB serial port, nothing is recorded until start().
+     * @param priority The priority of the writer task.
+     */
+    trace(int32_t priority = task::taskPrioritylow)
+    {
+      _log = nullptr;
+      _priority = priority;
+      _running = false;
+      _stopping = false;
+      _events = 0;
+      _blocks = 0;
+      _bytes = 0;
+      _lostBlocks = 0;
+    }
+    ~trace() {};
+
+    trace(const trace &) = delete;
+    trace &operator=(const trace &) = delete;
+
+    /**
+     * @brief Starts recording and the writer task.
+     * @return Returns false if the log cannot be started or another trace is running.
+     */
+    bool start()
+    {
+      if (_active != nullptr)
+        return _active == this && !_stopping;
+      if (_log != nullptr && !_log->running() && !_log->start())
+        return false;
+      for (_ring &r : _rings)
+      {
+        r.head = 0;
+        r.tail = 0;
+        r.open = 0;
+        r.dropped = 0;
+        r.reported = 0;
+      }
+      memset(_depth, 0, sizeof(_depth));
+      _lost = 0;
+      _running = true;
+      _stopping = false;
+      _active = this;
+      _task = task(_writer, this, _priority);
+      return true;
+    }
+
+    /**
+     * @brief Stops recording, the writer task writes what is left and ends.
+     */
+    void stop()
+    {
+      if (_running)
+        _stopping = true;
+    }
+
+    /**
+     * @brief Checks if the trace is running.
+     * @return Returns true from start() until stop() has written everything.
+     */
+    bool running() const { return _running; }
+
+    uint32_t events() const { return _events; }
+    uint32_t blocks() const { return _blocks; }
+    uint32_t bytes() const { return _bytes; }
+
+    /**
+     * @brief Gets the number of events not in the trace.
+     * @return Returns events dropped for a full ring or missing ring, and events in blocks that could not be written.
+     */
+    uint32_t dropped() const
+    {
+      uint32_t n = _lost + _lostBlocks;
+      for (const _ring &r : _rings)
+        n += r.dropped;
+      return n;
+    }
+
+    /**
+     * @brief Begins a scope on the current task, VEX_TRACE_SCOPE calls this.
+     * @return Returns true if the begin was stored, end() must then be called once.
+     * @param name The name of the scope.
+     */
+    static bool begin(const char *name)
+    {
+      _ring *r = _recording() ? _find(true) : nullptr;
+      if (r == nullptr)
+        return false;
+      // keep room for the end of every open scope
+      if (TRACE_RING_SIZE - (r->head - r->tail) < r->open + 2)
+      {
+        r->dropped = r->dropped + 1;
+        return false;
+      }
+      _push(r, TRACE_TAG_BEGIN, name);
+      r->open = r->open + 1;
+      return true;
+    }
+
+    /**
+     * @brief Ends the last scope begun on the current task.
+     */
+    static void end()
+    {
+      _ring *r = _find(false);
+      if (r == nullptr || r->open == 0)
+        return;
+      r->open = r->open - 1;
+      _push(r, TRACE_TAG_END, nullptr);
+    }
+
+    /**
+     * @brief Marks a moment on the current task.
+     * @param name The name of the mark.
+     */
+    static void mark(const char *name)
+    {
+      _ring *r = _recording() ? _find(true) : nullptr;
+      if (r == nullptr)
+        return;
+      if (TRACE_RING_SIZE - (r->head - r->tail) < r->open + 1)
+      {
+        r->dropped = r->dropped + 1;
+        return;
+      }
+      _push(r, TRACE_TAG_MARK, name);
+    }
+
+    /**
+     * @brief Names the current task in traces, it keeps the name until the program ends.
+     * @param name The name of the task.
+     */
+    static void threadName(const char *name)
+    {
+      _ring *r = _find(true);
+      if (r != nullptr)
+        r->name = name;
+    }
+
+  private:
+    struct _event
+    {
+      uint64_t time;
+      const char *name;
+      uint32_t tag;
+    };
+
+    struct _ring
+    {
+      int32_t owner;          // task id + 1, 0 while free
+      volatile uint32_t head; // only changed by the owner
+      volatile uint32_t tail; // only changed by the writer task
+      volatile uint32_t open;
+      volatile uint32_t dropped;
+      uint32_t reported; // dropped count already in the trace
+      const char *name;
+      _event events[TRACE_RING_SIZE];
+    };
+
+    static inline trace *_active = nullptr;
+    static inline _ring _rings[TRACE_MAX_THREADS] = {};
+    static inline int32_t _last = 0;
+    static inline volatile uint32_t _lost = 0;
+
+    sdlogger *_log;
+    int32_t _priority;
+    task _task;
+    volatile bool _running;
+    volatile bool _stopping;
+    uint32_t _events;
+    uint32_t _blocks;
+    uint32_t _bytes;
+    uint32_t _lostBlocks;
+
+    // the block being built by the writer task
+    uint8_t _block[TRACE_BLOCK_SIZE];
+    uint32_t _used;
+    uint64_t _time;
+    uint32_t _blockEvents;
+    uint32_t _threadsSent;
+    const char *_names[TRACE_MAX_NAMES];
+    uint32_t _nameCount;
+    uint32_t _depth[TRACE_MAX_THREADS]; // scopes written but not yet ended
+
+    static bool _recording()
+    {
+      return _active != nullptr && !_active->_stopping;
+    }
+
+    static _ring *_find(bool claim)
+    {
+      int32_t owner = this_thread::get_id() + 1;
+      if (_rings[_last].owner == owner)
+        return &_rings[_last];
+      for (int32_t i = 0; i < TRACE_MAX_THREADS; i++)
+      {
+        if (_rings[i].owner == owner)
+        {
+          _last = i;
+          return &_rings[i];
+        }
+      }
+      if (!claim)
+        return nullptr;
+      for (int32_t i = 0; i < TRACE_MAX_THREADS; i++)
+      {
+        if (_rings[i].owner == 0)
+        {
+          _rings[i].owner = owner;
+          _rings[i].name = nullptr;
+          _last = i;
+          return &_rings[i];
+        }
+      }
+      _lost = _lost + 1;
+      return nullptr;
+    }
+
+    static void _push(_ring *r, uint32_t tag, const char *name)
+    {
+      _event &e = r->events[r->head % TRACE_RING_SIZE];
+      e.time = vexSystemHighResTimeGet();
+      e.name = name;
+      e.tag = tag;
+      r->head = r->head + 1;
+    }
+
+    static int _writer(void *arg)
+    {
+      trace *self = (trace *)arg;
+      while (true)
+      {
+        bool stopping = self->_stopping;
+        self->_drain();
+        if (stopping)
+        {
+          self->_endScopes();
+          break;
+        }
+        task::sleep(TRACE_FLUSH_INTERVAL);
+      }
+      if (self->_log != nullptr)
+        self->_log->flush();
+      _active = nullptr;
+      self->_stopping = false;
+      self->_running = false;
+      return 0;
+    }
+
+    // writes every event stored so far, merged in time order
+    void _drain()
+    {
+      uint32_t heads[TRACE_MAX_THREADS];
+      for (int32_t i = 0; i < TRACE_MAX_THREADS; i++)
+        heads[i] = _rings[i].head;
+
+      _startBlock();
+      while (true)
+      {
+        int32_t next = -1;
+        for (int32_t i = 0; i < TRACE_MAX_THREADS; i++)
+        {
+          _ring &r = _rings[i];
+          if (r.tail != heads[i] && (next < 0 || r.events[r.tail % TRACE_RING_SIZE].time <
+                                                     _rings[next].events[_rings[next].tail % TRACE_RING_SIZE].time))
+            next = i;
+        }
+        if (next < 0)
+          break;
+
+        _ring &r = _rings[next];
+        const _event &e = r.events[r.tail % TRACE_RING_SIZE];
+        if (!_room() || (e.name != nullptr && _nameId(e.name) < 0 && _nameCount >= TRACE_MAX_NAMES))
+        {
+          _writeBlock();
+          _startBlock();
+        }
+
+        _putBase(e.time);
+        _putThread(next);
+        int32_t id = e.name != nullptr ? _putName(e.name) : 0;
+        _block[_used++] = e.tag;
+        _block[_used++] = next;
+        _used += traceformat::putVarint(_block + _used, e.time - _time);
+        if (e.tag != TRACE_TAG_END)
+          _used += traceformat::putVarint(_block + _used, id);
+        if (e.tag == TRACE_TAG_BEGIN)
+          _depth[next]++;
+        else if (e.tag == TRACE_TAG_END)
+          _depth[next]--;
+        _time = e.time;
+        _blockEvents++;
+        _events++;
+        r.tail = r.tail + 1;
+      }
+
+      // events that did not fit in a ring
+      for (int32_t i = 0; i < TRACE_MAX_THREADS; i++)
+      {
+        uint32_t dropped = _rings[i].dropped;
+        if (dropped == _rings[i].reported)
+          continue;
+        if (!_room())
+        {
+          _writeBlock();
+          _startBlock();
+        }
+        _putBase(vexSystemHighResTimeGet());
+        _putThread(i);
+        _block[_used++] = TRACE_TAG_DROPPED;
+        _block[_used++] = i;
+        _used += traceformat::putVarint(_block + _used, dropped - _rings[i].reported);
+        _rings[i].reported = dropped;
+        _blockEvents++;
+      }
+      _writeBlock();
+    }
+
+    // ends the scopes written but not ended, their ends come after the last drain
+    void _endScopes()
+    {
+      uint64_t now = vexSystemHighResTimeGet();
+      _startBlock();
+      for (int32_t i = 0; i < TRACE_MAX_THREADS; i++)
+      {
+        for (; _depth[i] > 0; _depth[i]--)
+        {
+          if (!_room())
+          {
+            _writeBlock();
+            _startBlock();
+          }
+          _putBase(now);
+          _putThread(i);
+          _block[_used++] = TRACE_TAG_END;
+          _block[_used++] = i;
+          _used += traceformat::putVarint(_block + _used, now - _time);
+          _time = now;
+          _blockEvents++;
+          _events++;
+        }
+      }
+      _writeBlock();
+    }
+
+    void _startBlock()
+    {
+      _used = TRACE_HEADER_SIZE;
+      _blockEvents = 0;
+      _threadsSent = 0;
+      _nameCount = 0;
+    }
+
+    // the payload starts with the time of its first event
+    void _putBase(uint64_t time)
+    {
+      if (_used > TRACE_HEADER_SIZE)
+        return;
+      _used += traceformat::putVarint(_block + _used, time);
+      _time = time;
+    }
+
+    // room for the time, a thread record, a name record and an event
+    bool _room() const
+    {
+      return _used + 10 + 2 * (3 + 10 + TRACE_MAX_NAME) + 22 <= TRACE_BLOCK_SIZE;
+    }
+
+    void _putThread(int32_t thread)
+    {
+      if (_threadsSent & (1 << thread))
+        return;
+      _threadsSent |= 1 << thread;
+      const char *name = _rings[thread].name != nullptr ? _rings[thread].name : "";
+      uint32_t len = strnlen(name, TRACE_MAX_NAME);
+      _block[_used++] = TRACE_TAG_THREAD;
+      _block[_used++] = thread;
+      _used += traceformat::putVarint(_block + _used, _rings[thread].owner - 1);
+      _block[_used++] = len;
+      memcpy(_block + _used, name, len);
+      _used += len;
+    }
+
+    int32_t _nameId(const char *name) const
+    {
+      for (uint32_t i = 0; i < _nameCount; i++)
+        if (_names[i] == name)
+          return i;
+      return -1;
+    }
+
+    int32_t _putName(const char *name)
+    {
+      int32_t id = _nameId(name);
+      if (id >= 0)
+        return id;
+      id = _nameCount++;
+      _names[id] = name;
+      uint32_t len = strnlen(name, TRACE_MAX_NAME);
+      _block[_used++] = TRACE_TAG_NAME;
+      _used += traceformat::putVarint(_block + _used, id);
+      _block[_used++] = len;
+      memcpy(_block + _used, name, len);
+      _used += len;
+      return id;
+    }
+
+    void _writeBlock()
+    {
+      if (_blockEvents == 0)
+        return;
+      uint32_t len = _used - TRACE_HEADER_SIZE;
+      traceformat::putHeader(_block, len, traceformat::checksum(_block + TRACE_HEADER_SIZE, len));
+      bool ok;
+      if (_log != nullptr)
+        ok = _log->write(_block, _used);
+      else
+      {
+        // wait for the serial port rather than lose the block
+        uint32_t start = vexSystemTimeGet();
+        while (vexSerialWriteFree(1) < (int32_t)_used && vexSystemTimeGet() - start < TRACE_SERIAL_WAIT)
+          task::sleep(1);
+        ok = vexSerialWriteFree(1) >= (int32_t)_used && vexSerialWriteBuffer(1, _block, _used) == (int32_t)_used;
+      }
+      if (ok)
+      {
+        _blocks++;
+        _bytes += _used;
+      }
+      else
+        _lostBlocks += _blockEvents;
+      _blockEvents = 0;
+    }
+  };
+
+  /**
+   * @brief Traces its lifetime, use VEX_TRACE_SCOPE.
+   */
+  class tracescope
+  {
+  public:
+    tracescope(const char *name) { _open = trace::begin(name); }
+    ~tracescope()
+    {
+      if (_open)
+        trace::end();
+    };
+
+    tracescope(const tracescope &) = delete;
+    tracescope &operator=(const tracescope &) = delete;
+
+  private:
+    bool _open;
+  };
+};
+
+#endif // VEX_TRACE_CLASS_H
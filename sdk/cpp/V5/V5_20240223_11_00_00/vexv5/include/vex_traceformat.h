@@ -0,0 +1,125 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_traceformat.h                                           */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_TRACEFORMAT_H
+#define VEX_TRACEFORMAT_H
+
+#include <stdint.h>
+
+#include "vex_varint.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_traceformat.h
+ * @brief   Binary trace format
+ * @details
+ *  A trace is a sequence of blocks, each one complete in itself so a
+ *  decoder can start at any block and skip damaged ones, for example where
+ *  printf output was mixed into a trace sent over the serial port.
+ *
+ *    magic uint32_t, version, payload length uint16_t, checksum uint16_t
+ *    payload, the time of the block in uS followed by records
+ *
+ *  Every record starts with a tag byte.
+ *
+ *    TRACE_TAG_NAME     name id, length and that many characters, the name
+ *                       used by later records in the block with that id
+ *    TRACE_TAG_THREAD   thread, task id, length and that many characters,
+ *                       written before the first event of a thread
+ *    TRACE_TAG_BEGIN    thread, time since the last event, name id
+ *    TRACE_TAG_END      thread, time since the last event, ends the last
+ *                       scope begun on the thread
+ *    TRACE_TAG_MARK     thread, time since the last event, name id
+ *    TRACE_TAG_DROPPED  thread, number of scopes and marks not recorded
+ *                       because its buffer was full
+ *
+ *  Numbers are LEB128 varints except the thread, a byte, and the header
+ *  fields, little endian.  The checksum is the sum of the payload bytes.
+ *  Events are in time order across all threads, a scope begun in one
+ *  block may end in a later one.
+ *  tools/host/trace2json.cpp converts traces with it.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace traceformat
+  {
+    using varint::putVarint;
+    using varint::getVarint;
+
+#define TRACE_MAGIC 0x52543556 // "V5TR"
+#define TRACE_VERSION 1
+#define TRACE_HEADER_SIZE 9
+#define TRACE_MAX_NAME 31
+
+#define TRACE_TAG_NAME 0x01
+#define TRACE_TAG_THREAD 0x02
+#define TRACE_TAG_BEGIN 0x03
+#define TRACE_TAG_END 0x04
+#define TRACE_TAG_MARK 0x05
+#define TRACE_TAG_DROPPED 0x06
+
+    /**
+     * @brief Computes the checksum of a payload.
+     * @return Returns the sum of the bytes.
+     * @param p The payload.
+     * @param len The length of the payload in bytes.
+     */
+    inline uint16_t checksum(const uint8_t *p, uint32_t len)
+    {
+      uint16_t sum = 0;
+      for (uint32_t i = 0; i < len; i++)
+        sum = sum + p[i];
+      return sum;
+    }
+
+    /**
+     * @brief Writes a block header.
+     * @param p The output, TRACE_HEADER_SIZE bytes.
+     * @param len The length of the payload that follows.
+     * @param check The checksum of the payload.
+     */
+    inline void putHeader(uint8_t *p, uint16_t len, uint16_t check)
+    {
+      p[0] = (uint8_t)TRACE_MAGIC;
+      p[1] = (uint8_t)(TRACE_MAGIC >> 8);
+      p[2] = (uint8_t)(TRACE_MAGIC >> 16);
+      p[3] = (uint8_t)(TRACE_MAGIC >> 24);
+      p[4] = TRACE_VERSION;
+      p[5] = (uint8_t)len;
+      p[6] = (uint8_t)(len >> 8);
+      p[7] = (uint8_t)check;
+      p[8] = (uint8_t)(check >> 8);
+    }
+
+    /**
+     * @brief Finds the payload of a block.
+     * @return Returns the length of the payload, or -1 if p is not the start of an intact block.
+     * @param p The input.
+     * @param end The end of the input.
+     */
+    inline int32_t getBlock(const uint8_t *p, const uint8_t *end)
+    {
+      if (end - p < TRACE_HEADER_SIZE)
+        return -1;
+      uint32_t magic = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+      uint32_t len = p[5] | (p[6] << 8);
+      uint16_t check = p[7] | (p[8] << 8);
+      if (magic != TRACE_MAGIC || p[4] != TRACE_VERSION || end - p - TRACE_HEADER_SIZE < (int32_t)len)
+        return -1;
+      if (checksum(p + TRACE_HEADER_SIZE, len) != check)
+        return -1;
+      return len;
+    }
+  };
+};
+
+#endif // VEX_TRACEFORMAT_H
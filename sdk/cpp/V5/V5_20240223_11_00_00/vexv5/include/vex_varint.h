@@ -0,0 +1,75 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_varint.h                                                */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef VEX_VARINT_H
+#define VEX_VARINT_H
+
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_varint.h
+ * @brief   Variable length integers shared by the binary log formats
+ * @details
+ *  Unsigned values are LEB128 varints, 7 bits per byte, least significant
+ *  first, the top bit set on every byte but the last.  Signed values are
+ *  zigzag coded first so small negative numbers stay short.
+ *  The telemetry, input log and trace formats all use these.
+ */
+/*---------------------------------------------------------------------------*/
+
+namespace vex
+{
+  namespace varint
+  {
+    /**
+     * @brief Writes an unsigned varint.
+     * @return Returns the number of bytes written, at most 10.
+     * @param p The output.
+     * @param v The value.
+     */
+    inline uint32_t putVarint(uint8_t *p, uint64_t v)
+    {
+      uint32_t n = 0;
+      while (v >= 0x80)
+      {
+        p[n++] = (uint8_t)v | 0x80;
+        v >>= 7;
+      }
+      p[n++] = (uint8_t)v;
+      return n;
+    }
+
+    /**
+     * @brief Reads an unsigned varint.
+     * @return Returns false if the input ends first or the varint is longer than 10 bytes.
+     * @param p The input, moved past the varint.
+     * @param end The end of the input.
+     * @param v The value read.
+     */
+    inline bool getVarint(const uint8_t *&p, const uint8_t *end, uint64_t &v)
+    {
+      v = 0;
+      for (uint32_t shift = 0; shift < 70 && p < end; shift += 7)
+      {
+        uint8_t b = *p++;
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+          return true;
+      }
+      return false;
+    }
+
+    inline uint64_t zigzag(int64_t v) { return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63); }
+    inline int64_t unzigzag(uint64_t v) { return (int64_t)(v >> 1) ^ -(int64_t)(v & 1); }
+  };
+};
+
+#endif // VEX_VARINT_H
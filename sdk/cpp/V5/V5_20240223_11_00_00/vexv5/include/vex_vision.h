@@ -173,6 +173,45 @@ namespace vex
       const bool &exists;
     };
 
+    /**
+     * @brief A compact, trivially copyable copy of an object that can be memcpy'd into queues and history buffers.
+     */
+    class record
+    {
+      float _angle = 0;
+      int16_t _id = 0;
+      int16_t _originX = 0;
+      int16_t _originY = 0;
+      int16_t _centerX = 0;
+      int16_t _centerY = 0;
+      int16_t _width = 0;
+      int16_t _height = 0;
+      bool _exists = false;
+
+    public:
+      record() = default;
+
+      /**
+       * @brief Creates a new record holding the properties of an object.
+       * @param obj The object whose properties are to be copied.
+       */
+      record(const object &obj) : _angle((float)obj.angle), _id((int16_t)obj.id),
+                                  _originX((int16_t)obj.originX), _originY((int16_t)obj.originY),
+                                  _centerX((int16_t)obj.centerX), _centerY((int16_t)obj.centerY),
+                                  _width((int16_t)obj.width), _height((int16_t)obj.height),
+                                  _exists(obj.exists) {}
+
+      int32_t id() const { return _id; }
+      int32_t originX() const { return _originX; }
+      int32_t originY() const { return _originY; }
+      int32_t centerX() const { return _centerX; }
+      int32_t centerY() const { return _centerY; }
+      int32_t width() const { return _width; }
+      int32_t height() const { return _height; }
+      double angle() const { return _angle; }
+      bool exists() const { return _exists; }
+    };
+
     /**
      * @brief Use this class when programming the vision sensor.
      */
@@ -325,6 +364,34 @@ namespace vex
      */
     safearray<object, VISION_MAX_OBJECTS> objects;
 
+    /**
+     * @brief The objects found in the last data sample, accessed without bounds checks.
+     * @return Returns a span over the first objectCount entries of objects.
+     */
+    std::span<object> detected()
+    {
+      int32_t n = objectCount < 0 ? 0 : (objectCount > VISION_MAX_OBJECTS ? VISION_MAX_OBJECTS : objectCount);
+      return objects.span().first(n);
+    }
+
+    /**
+     * @brief Copies the objects found in the last data sample into compact records.
+     * @return Returns the number of records written.
+     * @param buffer Pointer to an array of records.
+     * @param len The number of records the buffer can hold.
+     */
+    int32_t getRecords(record *buffer, int32_t len)
+    {
+      int32_t n = 0;
+      for (object &obj : detected())
+      {
+        if (n >= len)
+          break;
+        buffer[n++] = record(obj);
+      }
+      return n;
+    }
+
     // not part of current spec
     bool setSignature(V5_DeviceVisionSignature *pSignature);
     bool getSignature(uint32_t id, V5_DeviceVisionSignature *pSignature);
@@ -394,6 +461,8 @@ namespace vex
   };
 };
 
+static_assert(std::is_trivially_copyable<vex::vision::record>::value, "vision::record must stay trivially copyable");
+
 typedef vex::vision::object VexVisionObject;
 typedef vex::vision::code VisionCode;
 
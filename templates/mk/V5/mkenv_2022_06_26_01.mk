@@ -74,8 +74,11 @@ CFLAGS_V7 = -march=armv7-a -mfpu=neon -mfloat-abi=softfp
 CFLAGS    = ${CFLAGS_CL} ${CFLAGS_V7} -O3 -Wall -Wextra -Werror=return-type -std=gnu23 $(DEFINES)
 CXX_FLAGS = ${CFLAGS_CL} ${CFLAGS_V7} -O3 -Wall -Wextra -Werror=return-type -fno-rtti -Wno-cast-function-type -fno-threadsafe-statics -std=gnu++23 -ffunction-sections -fdata-sections $(DEFINES)
 
+# Linker script, a copy with the ORDER_FILE functions when one is given
+LSCRIPT = $(VEX_SDK_PATH)/$(PLATFORM)/lscript.ld
+
 # Linker flags
-LNK_FLAGS = -z noexecstack --no-warn-rwx-segments -nostdlib -T "$(VEX_SDK_PATH)/$(PLATFORM)/lscript.ld" -R "$(VEX_SDK_PATH)/$(PLATFORM)/stdlib_0.lib" -Map="$(BUILD)/$(PROJECT).map" --gc-section -L"$(VEX_SDK_PATH)/$(PLATFORM)" ${TOOL_LIB}
+LNK_FLAGS = -z noexecstack --no-warn-rwx-segments -nostdlib -T "$(LSCRIPT)" -R "$(VEX_SDK_PATH)/$(PLATFORM)/stdlib_0.lib" -Map="$(BUILD)/$(PROJECT).map" --gc-section -L"$(VEX_SDK_PATH)/$(PLATFORM)" ${TOOL_LIB}
 
 # Future static library
 PROJECTLIB = lib$(PROJECT)
@@ -84,6 +87,36 @@ ARCH_FLAGS = rcs
 # Libraries
 LIBS =  --start-group -lv5rt -lstdc++ -lc -lm -lgcc --end-group
 
+# Slim runtime profile, no exceptions or unwind tables and libsupc++ only
+# brain::sdcard load/save/append use fstreams internally and need the full profile
+ifeq ($(SLIM),1)
+CXX_FLAGS += -fno-exceptions -fno-unwind-tables -fno-asynchronous-unwind-tables
+LIBS =  --start-group -lv5rt -lsupc++ -lc -lm -lgcc --end-group
+endif
+
+# Profile guided function order, one mangled symbol per line, passed from app
+# the .text.<symbol> section of each listed function is added to the hot region
+# of a copy of lscript.ld written to the build directory when linking
+ifneq ($(ORDER_FILE),)
+define newline
+
+
+endef
+ORDER_INDENT = $(newline)$(sp)$(sp)$(sp)
+ORDER_SECTIONS = $(subst $(sp),$(ORDER_INDENT),$(sp)$(patsubst %,*(.text.%),$(file < $(ORDER_FILE))))
+ORDER_SCRIPT = $(subst /* ORDER_FILE */,/* ORDER_FILE */$(ORDER_SECTIONS),$(file < $(VEX_SDK_PATH)/$(PLATFORM)/lscript.ld))
+LSCRIPT = $(BUILD)/lscript.ld
+endif
+
+# Device input record and replay, every function listed in vex_inputlogformat.h
+# is routed through vex/vex_inputlog.cpp with the linker's --wrap option
+ifeq ($(INPUTLOG),1)
+lparen := (
+comma  := ,
+INPUTLOG_FUNCTIONS := $(patsubst X$(lparen)%$(comma),%,$(filter X$(lparen)vex%,$(file < $(VEX_SDK_PATH)/$(PLATFORM)/include/vex_inputlogformat.h)))
+LNK_FLAGS += $(addprefix --wrap=,$(INPUTLOG_FUNCTIONS))
+endif
+
 # Include file paths
 INC += $(addprefix -I, ${INC_F})
 INC += -I"$(VEX_SDK_PATH)/$(PLATFORM)/include"
@@ -0,0 +1,109 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     fbdump.cpp                                                  */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    fbdump.cpp
+ * @brief   Converts raw frame buffer dumps to PNG or BMP
+ * @details
+ *  Reads 32 bit little endian 0x00RRGGBB pixels, a raw vex::screencapture
+ *  file or the frame buffer memory of a host simulation, and writes it with
+ *  the same captureformat::encoder the brain uses.  The output format comes
+ *  from the file extension, .bmp or anything else for PNG.
+ *
+ *    fbdump [-w width] [-h height] [-s stride] in.raw out.png
+ *
+ *    -w   width in pixels, default 480
+ *    -h   height in pixels, default as many rows as the file holds
+ *    -s   pixels between rows, default the width, 512 for a V5 canvas
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "vex_captureformat.h"
+
+using namespace vex::captureformat;
+
+static void
+usage()
+{
+  fprintf(stderr, "usage: fbdump [-w width] [-h height] [-s stride] in.raw out.png\n");
+  exit(2);
+}
+
+int main(int argc, char **argv)
+{
+  int32_t width = 480, height = 0, stride = 0;
+  const char *files[2] = {nullptr, nullptr};
+  int nfiles = 0;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+      width = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-h") == 0 && i + 1 < argc)
+      height = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+      stride = atoi(argv[++i]);
+    else if (argv[i][0] == '-' || nfiles == 2)
+      usage();
+    else
+      files[nfiles++] = argv[i];
+  }
+  if (nfiles != 2 || width <= 0 || width > CAPTURE_MAX_WIDTH)
+    usage();
+  if (stride < width)
+    stride = width;
+
+  FILE *fp = fopen(files[0], "rb");
+  if (fp == nullptr)
+  {
+    fprintf(stderr, "fbdump: cannot read %s\n", files[0]);
+    return 1;
+  }
+  std::vector<uint32_t> pixels;
+  uint8_t p[4];
+  while (fread(p, 1, 4, fp) == 4)
+    pixels.push_back(p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24));
+  fclose(fp);
+
+  // the last row only needs width pixels, not a whole stride
+  int32_t rows = pixels.size() < (size_t)width ? 0 : (int32_t)((pixels.size() - width) / stride + 1);
+  if (height <= 0)
+    height = rows;
+  if (height <= 0 || height > rows)
+  {
+    fprintf(stderr, "fbdump: %s holds %d rows of %d pixels\n", files[0], rows, width);
+    return 1;
+  }
+
+  const char *ext = strrchr(files[1], '.');
+  bool bmp = ext != nullptr && (strcmp(ext, ".bmp") == 0 || strcmp(ext, ".BMP") == 0);
+  encoder enc(pixels.data(), width, height, stride, bmp ? tCaptureFormat::kCaptureFormatBmp : tCaptureFormat::kCaptureFormatPng);
+
+  fp = fopen(files[1], "wb");
+  if (fp == nullptr)
+  {
+    fprintf(stderr, "fbdump: cannot write %s\n", files[1]);
+    return 1;
+  }
+  uint8_t chunk[4096];
+  uint32_t n;
+  while ((n = enc.next(chunk, sizeof(chunk))) > 0)
+    fwrite(chunk, 1, n, fp);
+  fclose(fp);
+
+  printf("%s: %dx%d, %u bytes\n", files[1], width, height, enc.size());
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     inputdump.cpp                                               */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    inputdump.cpp
+ * @brief   Prints a device input recording made by vex::inputlog
+ * @details
+ *  Writes one line per record, time in uS, function, port, argument and
+ *  value.  Values of functions returning a number are printed as that
+ *  number, structures as hex bytes in the brain's byte order.  With -s only
+ *  the number of records for each function and port is printed, with
+ *  -f name only records of that function.
+ *
+ *    inputdump [-s] [-f function] recording.inp
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "vex_inputlogformat.h"
+
+using namespace vex::inputlogformat;
+
+static void
+printValue(const record &r)
+{
+  const char *type = functionType(r.function);
+  if (strcmp(type, "double") == 0 && r.length == 8)
+  {
+    double v;
+    memcpy(&v, r.value, 8);
+    printf("%.9g", v);
+  }
+  else if ((strcmp(type, "int32_t") == 0 || strcmp(type, "uint32_t") == 0) && r.length == 4)
+  {
+    int32_t v;
+    memcpy(&v, r.value, 4);
+    if (type[0] == 'u')
+      printf("%" PRIu32, (uint32_t)v);
+    else
+      printf("%" PRId32, v);
+  }
+  else if ((strcmp(type, "bool") == 0 || strcmp(type, "uint8_t") == 0) && r.length == 1)
+    printf("%u", r.value[0]);
+  else
+  {
+    for (uint32_t i = 0; i < r.length; i++)
+      printf("%02x", r.value[i]);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  bool summary = false;
+  const char *only = nullptr;
+  const char *file = nullptr;
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-s") == 0)
+      summary = true;
+    else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+      only = argv[++i];
+    else if (argv[i][0] != '-' && file == nullptr)
+      file = argv[i];
+    else
+      file = nullptr, i = argc;
+  }
+  if (file == nullptr)
+  {
+    fprintf(stderr, "usage: inputdump [-s] [-f function] recording.inp\n");
+    return 2;
+  }
+
+  FILE *fp = fopen(file, "rb");
+  if (fp == nullptr)
+  {
+    fprintf(stderr, "inputdump: cannot read %s\n", file);
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    data.insert(data.end(), buf, buf + n);
+  fclose(fp);
+
+  const uint8_t *p = data.data(), *end = p + data.size();
+  if (data.size() < 5 || (p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24)) != INPUTLOG_MAGIC)
+  {
+    fprintf(stderr, "inputdump: %s is not an input recording\n", file);
+    return 1;
+  }
+  if (p[4] != INPUTLOG_VERSION)
+  {
+    fprintf(stderr, "inputdump: %s is version %u, expected %u\n", file, p[4], INPUTLOG_VERSION);
+    return 1;
+  }
+  p += 5;
+
+  record r = {};
+  uint32_t records = 0;
+  std::map<std::pair<uint32_t, uint32_t>, uint32_t> counts;
+  while (p < end)
+  {
+    uint32_t used = getRecord(p, end, r);
+    if (used == 0)
+    {
+      fprintf(stderr, "inputdump: damaged or cut short after %u records, %zu bytes left\n", records, (size_t)(end - p));
+      break;
+    }
+    p += used;
+    records++;
+    if (only != nullptr && strcmp(functionName(r.function), only) != 0)
+      continue;
+    if (summary)
+    {
+      counts[{r.function, r.port}]++;
+      continue;
+    }
+
+    printf("%10" PRIu64 " %-38s ", r.time, functionName(r.function));
+    if (r.port == INPUTLOG_NO_PORT)
+      printf("   - ");
+    else
+      printf("%4u ", r.port);
+    printf("%5" PRIu32 " ", r.argument);
+    printValue(r);
+    printf("\n");
+  }
+
+  if (summary)
+  {
+    for (auto &c : counts)
+    {
+      printf("%-38s ", functionName(c.first.first));
+      if (c.first.second == INPUTLOG_NO_PORT)
+        printf("   - ");
+      else
+        printf("%4u ", c.first.second);
+      printf("%8u\n", c.second);
+    }
+  }
+  fprintf(stderr, "%u records, %.3f s\n", records, r.time / 1e6);
+  return 0;
+}
@@ -0,0 +1,132 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     pixelbench.cpp                                              */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    pixelbench.cpp
+ * @brief   Host benchmark for the vex_pixel.h kernels
+ * @details
+ *  Runs every kernel in its scalar and vector form over a full V5 screen,
+ *  checks that both produce the same pixels and prints the throughput.
+ *  Build with the makefile in this directory, it turns off auto vectorization
+ *  so the scalar column really is scalar.
+ *
+ *    pixelbench [iterations]
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "vex_pixel.h"
+
+#define WIDTH 480
+#define HEIGHT 272
+#define STRIDE 512
+#define PIXELS (WIDTH * HEIGHT)
+
+static std::vector<uint32_t> srcFrame(STRIDE *HEIGHT);
+static std::vector<uint32_t> dstScalar(STRIDE *HEIGHT);
+static std::vector<uint32_t> dstVector(STRIDE *HEIGHT);
+static std::vector<uint16_t> rgb565Scalar(PIXELS);
+static std::vector<uint16_t> rgb565Vector(PIXELS);
+
+static volatile uint32_t sink;
+
+template <class F>
+static double
+measure(int iterations, F f)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+  {
+    f(i);
+    sink = sink + 1;
+  }
+  std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+  return (double)PIXELS * iterations / t.count() / 1e6;
+}
+
+template <class T>
+static bool
+same(const std::vector<T> &a, const std::vector<T> &b)
+{
+  return a.size() == b.size() && memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+static void
+report(const char *name, double scalar, double vector, bool match)
+{
+  printf("%-12s %10.1f %10.1f %7.2fx  %s\n", name, scalar, vector, vector / scalar, match ? "ok" : "MISMATCH");
+}
+
+int main(int argc, char **argv)
+{
+  int iterations = argc > 1 ? atoi(argv[1]) : 200;
+  if (iterations <= 0)
+    iterations = 1;
+
+  srand(1);
+  for (uint32_t &p : srcFrame)
+    p = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+
+  int failures = 0;
+  double s, v;
+  bool ok;
+
+  printf("%-12s %10s %10s %8s\n", "kernel", "scalar", "vector", "speedup");
+  printf("%-12s %10s %10s\n", "", "Mpix/s", "Mpix/s");
+
+  s = measure(iterations, [](int i)
+              { vex::pixel::scalar::fill(dstScalar.data(), STRIDE, WIDTH, HEIGHT, 0x102030 + i); });
+  v = measure(iterations, [](int i)
+              { vex::pixel::fill(dstVector.data(), STRIDE, WIDTH, HEIGHT, 0x102030 + i); });
+  ok = same(dstScalar, dstVector);
+  failures += !ok;
+  report("fill", s, v, ok);
+
+  // odd offsets so the rows are not 16 byte aligned
+  s = measure(iterations, [](int)
+              { vex::pixel::scalar::copy(dstScalar.data() + 1, STRIDE, srcFrame.data() + 3, STRIDE, WIDTH - 3, HEIGHT); });
+  v = measure(iterations, [](int)
+              { vex::pixel::copy(dstVector.data() + 1, STRIDE, srcFrame.data() + 3, STRIDE, WIDTH - 3, HEIGHT); });
+  ok = same(dstScalar, dstVector);
+  failures += !ok;
+  report("copy", s, v, ok);
+
+  s = measure(iterations, [](int)
+              { vex::pixel::scalar::blend(dstScalar.data(), STRIDE, srcFrame.data(), STRIDE, WIDTH, HEIGHT); });
+  v = measure(iterations, [](int)
+              { vex::pixel::blend(dstVector.data(), STRIDE, srcFrame.data(), STRIDE, WIDTH, HEIGHT); });
+  ok = same(dstScalar, dstVector);
+  failures += !ok;
+  report("blend", s, v, ok);
+
+  s = measure(iterations, [](int)
+              { vex::pixel::scalar::toRgb565(rgb565Scalar.data(), srcFrame.data(), PIXELS); });
+  v = measure(iterations, [](int)
+              { vex::pixel::toRgb565(rgb565Vector.data(), srcFrame.data(), PIXELS); });
+  ok = same(rgb565Scalar, rgb565Vector);
+  failures += !ok;
+  report("toRgb565", s, v, ok);
+
+  s = measure(iterations, [](int)
+              { vex::pixel::scalar::fromRgb565(dstScalar.data(), rgb565Scalar.data(), PIXELS); });
+  v = measure(iterations, [](int)
+              { vex::pixel::fromRgb565(dstVector.data(), rgb565Scalar.data(), PIXELS); });
+  ok = same(dstScalar, dstVector);
+  failures += !ok;
+  report("fromRgb565", s, v, ok);
+
+  return failures ? 1 : 0;
+}
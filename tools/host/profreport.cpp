@@ -0,0 +1,343 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     profreport.cpp                                              */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    profreport.cpp
+ * @brief   Lists the hottest functions of a vex::profiler profile
+ * @details
+ *  Reads a profile written by vex::profiler, see vex_profileformat.h, and
+ *  the symbols of the same build, from the .elf or from the .map the
+ *  linker writes next to it.  Prints the number of samples, share of all
+ *  samples and estimated time of the -n hottest functions, 30 by default.
+ *  Samples outside every function of the program, VEXos and its interrupt
+ *  handlers, are one line of their own.
+ *  With -o the functions that were sampled are written hottest first, one
+ *  symbol per line, ready to pass as ORDER_FILE to the example makefile.
+ *
+ *    profreport [-n count] [-o order.txt] run.prf build/project.elf|.map
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <string>
+#include <vector>
+
+#include "vex_profileformat.h"
+
+using namespace vex::profileformat;
+
+struct symbol
+{
+  uint32_t addr;
+  uint32_t size;
+  std::string name;
+  bool plain = false; // from a .text section holding several functions
+  uint64_t samples = 0;
+};
+
+static bool
+readFile(const char *name, std::vector<uint8_t> &data)
+{
+  FILE *fp = fopen(name, "rb");
+  if (fp == nullptr)
+    return false;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    data.insert(data.end(), buf, buf + n);
+  fclose(fp);
+  return true;
+}
+
+static uint32_t
+get32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t
+get16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+// function symbols from the symbol table of a 32 bit little endian ELF file
+static bool
+loadElf(const std::vector<uint8_t> &d, std::vector<symbol> &syms)
+{
+  if (d.size() < 52 || memcmp(d.data(), "\x7f" "ELF", 4) != 0 || d[4] != 1 || d[5] != 1)
+    return false;
+  uint32_t shoff = get32(&d[0x20]);
+  uint32_t shentsize = get16(&d[0x2E]);
+  uint32_t shnum = get16(&d[0x30]);
+  if (shentsize < 40 || shoff + (uint64_t)shnum * shentsize > d.size())
+    return false;
+
+  for (uint32_t i = 0; i < shnum; i++)
+  {
+    const uint8_t *sh = &d[shoff + i * shentsize];
+    if (get32(sh + 4) != 2) // SHT_SYMTAB
+      continue;
+    uint32_t off = get32(sh + 16), size = get32(sh + 20), link = get32(sh + 24);
+    if (link >= shnum || off + (uint64_t)size > d.size())
+      return false;
+    const uint8_t *str = &d[shoff + link * shentsize];
+    uint32_t stroff = get32(str + 16), strsize = get32(str + 20);
+    if (stroff + (uint64_t)strsize > d.size())
+      return false;
+
+    for (uint32_t s = 0; s + 16 <= size; s += 16)
+    {
+      const uint8_t *st = &d[off + s];
+      uint32_t name = get32(st);
+      if ((st[12] & 0xF) != 2 || get16(st + 14) == 0 || name >= strsize) // STT_FUNC, defined
+        continue;
+      const char *n = (const char *)&d[stroff + name];
+      syms.push_back({get32(st + 4) & ~1u, get32(st + 8), std::string(n, strnlen(n, strsize - name))});
+    }
+  }
+  return !syms.empty();
+}
+
+// the function of a .text.<name> section, hot and cold functions have the
+// compiler's .text.hot.<name> and .text.unlikely.<name> sections
+static std::string
+sectionFunction(const std::string &section)
+{
+  static const char *prefixes[] = {"hot.", "unlikely.", "startup.", "exit."};
+  std::string name = section.substr(6);
+  for (const char *p : prefixes)
+  {
+    size_t len = strlen(p);
+    if (name.size() > len && name.compare(0, len, p) == 0)
+      return name.substr(len);
+  }
+  return name;
+}
+
+// functions from the input sections of .text in a GNU ld map file, with
+// -ffunction-sections each function has a section named after it
+static bool
+loadMap(const std::vector<uint8_t> &d, std::vector<symbol> &syms)
+{
+  std::string text(d.begin(), d.end());
+  size_t pos = 0;
+  std::string pending;
+  uint32_t secAddr = 0, secEnd = 0;
+  bool plain = false; // in a .text section without a function name
+
+  while (pos < text.size())
+  {
+    size_t eol = text.find('\n', pos);
+    if (eol == std::string::npos)
+      eol = text.size();
+    std::string line = text.substr(pos, eol - pos);
+    pos = eol + 1;
+    if (!line.empty() && line.back() == '\r')
+      line.pop_back();
+
+    char name[1024];
+    uint32_t addr, size;
+    int used = 0;
+    if (line.size() > 1 && line[0] == ' ' && line[1] == '.')
+    {
+      // " .text.name" alone when the name is long, else followed by address and size
+      if (sscanf(line.c_str(), " %1023s %n", name, &used) < 1)
+        continue;
+      pending = name;
+      if (line[used] == 0)
+        continue;
+      line = "  " + line.substr(used);
+    }
+    if (!pending.empty() && sscanf(line.c_str(), " 0x%" SCNx32 " 0x%" SCNx32, &addr, &size) == 2)
+    {
+      plain = false;
+      secAddr = addr;
+      secEnd = addr + size;
+      if (pending.compare(0, 6, ".text.") == 0 && size > 0)
+        syms.push_back({addr & ~1u, size, sectionFunction(pending)});
+      else if (pending == ".text" && size > 0)
+        plain = true;
+      pending.clear();
+      continue;
+    }
+    pending.clear();
+
+    // symbols inside a plain .text section, "0x03800120    name"
+    if (plain && sscanf(line.c_str(), " 0x%" SCNx32 " %n", &addr, &used) == 1 && line[used] != 0 &&
+        line.compare(used, 7, "PROVIDE") != 0 && line[used] != '.' && line.find('=') == std::string::npos &&
+        addr >= secAddr && addr < secEnd)
+      syms.push_back({addr & ~1u, secEnd - addr, line.substr(used), true});
+  }
+
+  // symbols in plain sections end at the next one
+  std::sort(syms.begin(), syms.end(), [](const symbol &a, const symbol &b)
+            { return a.addr < b.addr; });
+  for (size_t i = 0; i + 1 < syms.size(); i++)
+    if (syms[i].plain)
+      syms[i].size = std::min(syms[i].size, syms[i + 1].addr - syms[i].addr);
+  return !syms.empty();
+}
+
+static std::string
+demangle(const std::string &name)
+{
+  int status = 0;
+  char *d = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+  if (d == nullptr)
+    return name;
+  std::string s = d;
+  free(d);
+  return s;
+}
+
+int main(int argc, char **argv)
+{
+  int count = 30;
+  const char *order = nullptr;
+  int i = 1;
+  for (; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+      count = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      order = argv[++i];
+    else
+      break;
+  }
+  if (argc - i != 2)
+  {
+    fprintf(stderr, "usage: profreport [-n count] [-o order.txt] run.prf build/project.elf|.map\n");
+    return 2;
+  }
+
+  std::vector<uint8_t> prof, image;
+  if (!readFile(argv[i], prof))
+  {
+    fprintf(stderr, "profreport: cannot read %s\n", argv[i]);
+    return 1;
+  }
+  if (!readFile(argv[i + 1], image))
+  {
+    fprintf(stderr, "profreport: cannot read %s\n", argv[i + 1]);
+    return 1;
+  }
+  std::vector<symbol> syms;
+  bool loaded = loadElf(image, syms);
+  if (!loaded)
+  {
+    syms.clear();
+    loaded = loadMap(image, syms);
+  }
+  if (!loaded)
+  {
+    fprintf(stderr, "profreport: no functions found in %s\n", argv[i + 1]);
+    return 1;
+  }
+  std::sort(syms.begin(), syms.end(), [](const symbol &a, const symbol &b)
+            { return a.addr < b.addr; });
+
+  // samples
+  uint64_t total = 0, outside = 0, dropped = 0, ms = 0;
+  uint16_t interval = 0;
+  const uint8_t *p = prof.data(), *end = p + prof.size();
+  while (end - p >= 4)
+  {
+    uint32_t w = get32(p);
+    if (w == PROFILE_MAGIC)
+    {
+      if (end - p < PROFILE_HEADER_SIZE || !getHeader(p, interval))
+        break;
+      p += PROFILE_HEADER_SIZE;
+      continue;
+    }
+    if (interval == 0)
+      break;
+    p += 4;
+    if (w == PROFILE_DROPPED)
+    {
+      if (end - p < 4)
+        break;
+      dropped += get32(p);
+      p += 4;
+      continue;
+    }
+
+    total++;
+    ms += interval;
+    auto it = std::upper_bound(syms.begin(), syms.end(), w, [](uint32_t a, const symbol &s)
+                               { return a < s.addr; });
+    if (it != syms.begin() && w - (it - 1)->addr < (it - 1)->size)
+      (it - 1)->samples++;
+    else
+      outside++;
+  }
+  if (interval == 0)
+  {
+    fprintf(stderr, "profreport: %s is not a profile\n", argv[i]);
+    return 1;
+  }
+  if (end - p != 0)
+    fprintf(stderr, "profreport: %zu bytes at the end not read\n", (size_t)(end - p));
+  if (total == 0)
+  {
+    fprintf(stderr, "profreport: no samples\n");
+    return 1;
+  }
+
+  std::vector<symbol> hot;
+  for (const symbol &s : syms)
+    if (s.samples > 0)
+      hot.push_back(s);
+  std::stable_sort(hot.begin(), hot.end(), [](const symbol &a, const symbol &b)
+                   { return a.samples > b.samples; });
+  if (outside > 0)
+  {
+    symbol o = {0, 0, "[outside the program]"};
+    o.samples = outside;
+    auto at = std::find_if(hot.begin(), hot.end(), [&](const symbol &s)
+                           { return s.samples < outside; });
+    hot.insert(at, o);
+  }
+
+  printf("%" PRIu64 " samples every %u mS, %.3f s", total, interval, ms / 1000.0);
+  if (dropped > 0)
+    printf(", %" PRIu64 " dropped", dropped);
+  printf("\n\n   samples      %%   cum %%     mS  function\n");
+  uint64_t cum = 0;
+  for (int n = 0; n < (int)hot.size() && n < count; n++)
+  {
+    cum += hot[n].samples;
+    printf("%10" PRIu64 " %6.2f %7.2f %6" PRIu64 "  %s\n", hot[n].samples, 100.0 * hot[n].samples / total,
+           100.0 * cum / total, hot[n].samples * interval, demangle(hot[n].name).c_str());
+  }
+
+  if (order != nullptr)
+  {
+    FILE *fp = fopen(order, "w");
+    if (fp == nullptr)
+    {
+      fprintf(stderr, "profreport: cannot write %s\n", order);
+      return 1;
+    }
+    // the makefile places .text.<symbol> sections, functions need one of their own
+    for (const symbol &s : hot)
+      if (s.size > 0 && !s.plain)
+        fprintf(fp, "%s\n", s.name.c_str());
+    fclose(fp);
+  }
+  return 0;
+}
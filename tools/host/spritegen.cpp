@@ -0,0 +1,493 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     spritegen.cpp                                               */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    spritegen.cpp
+ * @brief   Converts images to vex_spriteformat.h sprites for vex::sprite
+ * @details
+ *  Reads an uncompressed 24 or 32 bit BMP or a binary PPM (P6) and writes a
+ *  C source file holding one const array, so the sprite is linked into
+ *  .rodata.  Pixels with alpha below 128, and pixels of the -k color, are
+ *  transparent.  Every sprite is decoded again with the decoder the brain
+ *  uses and compared with the source before the file is written.
+ *
+ *    spritegen [-n name] [-k RRGGBB] [-r] [-p preview.ppm] -o out.c image
+ *
+ *    -n   array name, defaults to the image file name
+ *    -k   color to treat as transparent, hex
+ *    -r   store rows unencoded, faster to draw but larger
+ *    -p   also write the decoded sprite, transparent pixels magenta
+ *
+ *  Use the array from C++ with
+ *    extern const uint8_t name[];
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "vex_spriteformat.h"
+
+using namespace vex;
+
+struct image
+{
+  int32_t width = 0;
+  int32_t height = 0;
+  std::vector<uint32_t> argb; // alpha in the top byte, 255 is opaque
+};
+
+static std::vector<uint8_t>
+readFile(const char *name)
+{
+  std::vector<uint8_t> data;
+  FILE *fp = fopen(name, "rb");
+  if (fp == nullptr)
+    return data;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    data.insert(data.end(), buf, buf + n);
+  fclose(fp);
+  return data;
+}
+
+static uint32_t
+le32(const std::vector<uint8_t> &d, size_t i)
+{
+  return d[i] | (d[i + 1] << 8) | (d[i + 2] << 16) | ((uint32_t)d[i + 3] << 24);
+}
+
+static uint32_t
+le16(const std::vector<uint8_t> &d, size_t i)
+{
+  return d[i] | (d[i + 1] << 8);
+}
+
+// the value of a masked field scaled to 8 bits
+static uint32_t
+field(uint32_t p, uint32_t mask)
+{
+  if (mask == 0)
+    return 255;
+  int shift = 0;
+  while (!(mask & (1u << shift)))
+    shift++;
+  uint32_t max = mask >> shift;
+  return ((p & mask) >> shift) * 255 / max;
+}
+
+static bool
+readBmp(const std::vector<uint8_t> &d, image &img)
+{
+  if (d.size() < 54 || d[0] != 'B' || d[1] != 'M')
+    return false;
+
+  uint32_t offset = le32(d, 10);
+  uint32_t dib = le32(d, 14);
+  int32_t width = (int32_t)le32(d, 18);
+  int32_t height = (int32_t)le32(d, 22);
+  uint32_t bpp = le16(d, 28);
+  uint32_t compression = le32(d, 30);
+
+  if (width <= 0 || height == 0 || (bpp != 24 && bpp != 32) || (compression != 0 && compression != 3))
+  {
+    fprintf(stderr, "spritegen: only uncompressed 24 and 32 bit BMP files are supported\n");
+    return false;
+  }
+
+  uint32_t rm = 0x00FF0000, gm = 0x0000FF00, bm = 0x000000FF, am = 0;
+  if (bpp == 32)
+    am = 0xFF000000;
+  if (compression == 3 && d.size() >= 66)
+  {
+    rm = le32(d, 54);
+    gm = le32(d, 58);
+    bm = le32(d, 62);
+    am = dib >= 56 && d.size() >= 70 ? le32(d, 66) : 0;
+  }
+
+  bool bottomUp = height > 0;
+  if (height < 0)
+    height = -height;
+  size_t stride = ((bpp * width + 31) / 32) * 4;
+  if (offset + stride * height > d.size())
+    return false;
+
+  img.width = width;
+  img.height = height;
+  img.argb.resize((size_t)width * height);
+
+  // 32 bit files often leave the alpha byte 0, then every pixel is opaque
+  bool alpha = false;
+  for (int32_t y = 0; y < height; y++)
+  {
+    const uint8_t *row = &d[offset + stride * (bottomUp ? height - 1 - y : y)];
+    for (int32_t x = 0; x < width; x++)
+    {
+      uint32_t p = bpp == 32 ? row[x * 4] | (row[x * 4 + 1] << 8) | (row[x * 4 + 2] << 16) | ((uint32_t)row[x * 4 + 3] << 24)
+                             : row[x * 3] | (row[x * 3 + 1] << 8) | (row[x * 3 + 2] << 16);
+      uint32_t a = field(p, am);
+      alpha |= am != 0 && a != 0;
+      img.argb[(size_t)y * width + x] = (a << 24) | (field(p, rm) << 16) | (field(p, gm) << 8) | field(p, bm);
+    }
+  }
+  if (!alpha)
+    for (uint32_t &p : img.argb)
+      p |= 0xFF000000;
+  return true;
+}
+
+static bool
+readPpm(const std::vector<uint8_t> &d, image &img)
+{
+  if (d.size() < 2 || d[0] != 'P' || d[1] != '6')
+    return false;
+
+  size_t i = 2;
+  int32_t values[3];
+  for (int32_t &v : values)
+  {
+    while (i < d.size() && (isspace(d[i]) || d[i] == '#'))
+    {
+      if (d[i] == '#')
+        while (i < d.size() && d[i] != '\n')
+          i++;
+      else
+        i++;
+    }
+    v = 0;
+    while (i < d.size() && isdigit(d[i]))
+      v = v * 10 + (d[i++] - '0');
+  }
+  i++;
+
+  int32_t width = values[0], height = values[1], max = values[2];
+  if (width <= 0 || height <= 0 || max <= 0 || max > 255 || i + (size_t)width * height * 3 > d.size())
+  {
+    fprintf(stderr, "spritegen: only 8 bit binary PPM files are supported\n");
+    return false;
+  }
+
+  img.width = width;
+  img.height = height;
+  img.argb.resize((size_t)width * height);
+  for (uint32_t &p : img.argb)
+  {
+    p = 0xFF000000 | ((d[i] * 255 / max) << 16) | ((d[i + 1] * 255 / max) << 8) | (d[i + 2] * 255 / max);
+    i += 3;
+  }
+  return true;
+}
+
+static uint16_t
+rgb565(uint32_t argb)
+{
+  uint16_t c;
+  pixel::scalar::toRgb565(&c, &argb, 1);
+  return c;
+}
+
+static bool
+opaque(uint32_t argb)
+{
+  return (argb >> 24) >= 128;
+}
+
+// packets for one row, see vex_spriteformat.h
+static std::vector<uint16_t>
+encodeRow(const uint32_t *argb, int32_t width)
+{
+  std::vector<uint16_t> out;
+  int32_t x = 0;
+  while (x < width)
+  {
+    int32_t n = 1;
+    if (!opaque(argb[x]))
+    {
+      while (x + n < width && n < SPRITE_MAX_RUN && !opaque(argb[x + n]))
+        n++;
+      out.push_back(SPRITE_OP_SKIP | n);
+      x += n;
+      continue;
+    }
+
+    uint16_t c = rgb565(argb[x]);
+    while (x + n < width && n < SPRITE_MAX_RUN && opaque(argb[x + n]) && rgb565(argb[x + n]) == c)
+      n++;
+    if (n >= 3)
+    {
+      out.push_back(SPRITE_OP_REPEAT | n);
+      out.push_back(c);
+      x += n;
+      continue;
+    }
+
+    // a literal ends at a transparent pixel or where a run of three starts
+    n = 0;
+    size_t head = out.size();
+    out.push_back(0);
+    while (x < width && n < SPRITE_MAX_RUN && opaque(argb[x]))
+    {
+      c = rgb565(argb[x]);
+      if (x + 2 < width && opaque(argb[x + 1]) && opaque(argb[x + 2]) && rgb565(argb[x + 1]) == c && rgb565(argb[x + 2]) == c)
+        break;
+      out.push_back(c);
+      x++;
+      n++;
+    }
+    if (n == 0)
+      out.pop_back();
+    else
+      out[head] = SPRITE_OP_LITERAL | n;
+  }
+  return out;
+}
+
+static void
+put16(std::vector<uint8_t> &out, uint32_t v)
+{
+  out.push_back(v & 0xFF);
+  out.push_back((v >> 8) & 0xFF);
+}
+
+static void
+put32(std::vector<uint8_t> &out, uint32_t v)
+{
+  put16(out, v & 0xFFFF);
+  put16(out, v >> 16);
+}
+
+static bool
+encode(const image &img, bool rle, std::vector<uint8_t> &out)
+{
+  bool transparent = false;
+  std::vector<bool> used(65536, false);
+  for (uint32_t p : img.argb)
+  {
+    if (opaque(p))
+      used[rgb565(p)] = true;
+    else
+      transparent = true;
+  }
+
+  // unencoded rows need a key color no opaque pixel uses
+  uint32_t key = 0xF81F;
+  if (!rle && transparent)
+  {
+    while (key < 0x10000 + 0xF81F && used[key & 0xFFFF])
+      key++;
+    if (key >= 0x10000 + 0xF81F)
+    {
+      fprintf(stderr, "spritegen: no free key color, use RLE\n");
+      return false;
+    }
+    key &= 0xFFFF;
+  }
+
+  uint16_t flags = (rle ? SPRITE_FLAG_RLE : 0) | (transparent ? SPRITE_FLAG_TRANSPARENT : 0);
+  out.clear();
+  put32(out, SPRITE_MAGIC);
+  put16(out, img.width);
+  put16(out, img.height);
+  put16(out, flags);
+  put16(out, rle ? 0 : key);
+  put32(out, 0);
+
+  if (!rle)
+  {
+    for (uint32_t p : img.argb)
+      put16(out, opaque(p) ? rgb565(p) : key);
+  }
+  else
+  {
+    size_t table = out.size();
+    out.resize(table + 4 * img.height);
+
+    // identical rows share one copy
+    std::map<std::vector<uint16_t>, uint32_t> rows;
+    for (int32_t y = 0; y < img.height; y++)
+    {
+      std::vector<uint16_t> packets = encodeRow(&img.argb[(size_t)y * img.width], img.width);
+      auto it = rows.find(packets);
+      uint32_t offset = it != rows.end() ? it->second : (uint32_t)out.size();
+      if (it == rows.end())
+      {
+        rows[packets] = offset;
+        for (uint16_t v : packets)
+          put16(out, v);
+      }
+      for (int i = 0; i < 4; i++)
+        out[table + 4 * y + i] = (offset >> (8 * i)) & 0xFF;
+    }
+  }
+
+  uint32_t size = out.size();
+  for (int i = 0; i < 4; i++)
+    out[12 + i] = (size >> (8 * i)) & 0xFF;
+  return true;
+}
+
+// decode with the brain's decoder and compare with the source
+static bool
+verify(const image &img, const std::vector<uint8_t> &data, std::vector<uint32_t> &decoded)
+{
+  std::vector<uint32_t> aligned((data.size() + 3) / 4);
+  memcpy(aligned.data(), data.data(), data.size());
+  const spriteformat::header *h = spriteformat::check((const uint8_t *)aligned.data());
+  if (h == nullptr)
+    return false;
+
+  decoded.assign((size_t)img.width * img.height, 0x00FF00FF);
+  std::vector<uint8_t> mask(img.width);
+  for (int32_t y = 0; y < img.height; y++)
+  {
+    uint32_t *line = &decoded[(size_t)y * img.width];
+    spriteformat::decodeRow(h, y, 0, img.width, line, mask.data());
+    for (int32_t x = 0; x < img.width; x++)
+    {
+      uint32_t p = img.argb[(size_t)y * img.width + x];
+      uint32_t want = 0;
+      if (opaque(p))
+      {
+        uint16_t c = rgb565(p);
+        pixel::scalar::fromRgb565(&want, &c, 1);
+      }
+      if (mask[x] != opaque(p) || (mask[x] && line[x] != want))
+      {
+        fprintf(stderr, "spritegen: decode mismatch at %d,%d\n", x, y);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static std::string
+arrayName(const char *path)
+{
+  const char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+  const char *slash = strrchr(base, '\\');
+  base = slash ? slash + 1 : base;
+
+  std::string name;
+  for (const char *c = base; *c && *c != '.'; c++)
+    name += isalnum((unsigned char)*c) ? *c : '_';
+  if (name.empty() || isdigit((unsigned char)name[0]))
+    name = "sprite_" + name;
+  return name;
+}
+
+static void
+usage()
+{
+  fprintf(stderr, "usage: spritegen [-n name] [-k RRGGBB] [-r] [-p preview.ppm] -o out.c image\n");
+  exit(2);
+}
+
+int main(int argc, char **argv)
+{
+  const char *input = nullptr;
+  const char *output = nullptr;
+  const char *preview = nullptr;
+  std::string name;
+  bool rle = true;
+  int64_t key = -1;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+      name = argv[++i];
+    else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc)
+      key = strtol(argv[++i], nullptr, 16);
+    else if (strcmp(argv[i], "-r") == 0)
+      rle = false;
+    else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+      preview = argv[++i];
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      output = argv[++i];
+    else if (argv[i][0] == '-' || input != nullptr)
+      usage();
+    else
+      input = argv[i];
+  }
+  if (input == nullptr || output == nullptr)
+    usage();
+  if (name.empty())
+    name = arrayName(input);
+
+  std::vector<uint8_t> file = readFile(input);
+  image img;
+  if (!readBmp(file, img) && !readPpm(file, img))
+  {
+    fprintf(stderr, "spritegen: cannot read %s\n", input);
+    return 1;
+  }
+  if (img.width > 0xFFFF || img.height > 0xFFFF)
+  {
+    fprintf(stderr, "spritegen: %s is too large\n", input);
+    return 1;
+  }
+
+  if (key >= 0)
+    for (uint32_t &p : img.argb)
+      if ((p & 0xFFFFFF) == (uint32_t)key)
+        p &= 0xFFFFFF;
+
+  std::vector<uint8_t> data;
+  std::vector<uint32_t> decoded;
+  if (!encode(img, rle, data))
+    return 1;
+  if (!verify(img, data, decoded))
+    return 1;
+
+  FILE *fp = fopen(output, "w");
+  if (fp == nullptr)
+  {
+    fprintf(stderr, "spritegen: cannot write %s\n", output);
+    return 1;
+  }
+  fprintf(fp, "/* generated by spritegen from %s, do not edit */\n", input);
+  fprintf(fp, "/* %dx%d%s%s, %zu bytes */\n\n", img.width, img.height, rle ? " RLE" : "",
+          (data[8] & SPRITE_FLAG_TRANSPARENT) ? " transparent" : "", data.size());
+  fprintf(fp, "#include <stdint.h>\n\n");
+  fprintf(fp, "const uint8_t %s[%zu] __attribute__((aligned(4))) = {", name.c_str(), data.size());
+  for (size_t i = 0; i < data.size(); i++)
+    fprintf(fp, "%s0x%02X,", i % 12 == 0 ? "\n  " : " ", data[i]);
+  fprintf(fp, "\n};\n");
+  fclose(fp);
+
+  if (preview != nullptr)
+  {
+    fp = fopen(preview, "wb");
+    if (fp == nullptr)
+    {
+      fprintf(stderr, "spritegen: cannot write %s\n", preview);
+      return 1;
+    }
+    fprintf(fp, "P6\n%d %d\n255\n", img.width, img.height);
+    for (uint32_t p : decoded)
+    {
+      uint8_t rgb[3] = {(uint8_t)(p >> 16), (uint8_t)(p >> 8), (uint8_t)p};
+      fwrite(rgb, 1, 3, fp);
+    }
+    fclose(fp);
+  }
+
+  printf("%s: %dx%d, %zu bytes, %d as 32 bit pixels\n", name.c_str(), img.width, img.height, data.size(), img.width * img.height * 4);
+  return 0;
+}
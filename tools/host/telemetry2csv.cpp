@@ -0,0 +1,275 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     telemetry2csv.cpp                                           */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    telemetry2csv.cpp
+ * @brief   Decodes vex::telemetry logs to CSV or column files
+ * @details
+ *  Reads a log written by vex::telemetry, see vex_telemetryformat.h, and
+ *  writes one CSV row per record, the first column is the time in uS.  A new
+ *  header row is written whenever the schema changes.  With -c every column
+ *  goes to its own file, prefix.name.txt, one value per line, ready for
+ *  numpy.loadtxt or a column store import.
+ *  Every record is checked against its CRC.  Damaged data is skipped up to
+ *  the next schema block or key record with a matching CRC, delta records
+ *  in between are not applied.  Records dropped on the brain are counted
+ *  from the key records.  Both are reported on stderr.
+ *
+ *    telemetry2csv [-c prefix] log.tlm [out.csv]
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "vex_telemetryformat.h"
+
+using namespace vex::telemetryformat;
+
+struct field
+{
+  tFieldType type;
+  float resolution;
+  int decimals;
+  std::string name;
+};
+
+struct decoder
+{
+  std::vector<field> fields;
+  std::vector<int64_t> prev;
+  uint64_t time = 0;
+  bool haveKey = false;
+};
+
+// parses the block at p, returns false if it is not valid
+static bool
+parseSchema(const uint8_t *&p, const uint8_t *end, decoder &d)
+{
+  const uint8_t *q = p + 1;
+  if (end - q < 6)
+    return false;
+  uint32_t magic = q[0] | (q[1] << 8) | (q[2] << 16) | ((uint32_t)q[3] << 24);
+  if (magic != TELEMETRY_MAGIC || q[4] != TELEMETRY_VERSION || q[5] == 0 || q[5] > TELEMETRY_MAX_FIELDS)
+    return false;
+  int count = q[5];
+  q += 6;
+
+  std::vector<field> fields;
+  for (int i = 0; i < count; i++)
+  {
+    field f;
+    float res;
+    if (q >= end || *q > (uint8_t)tFieldType::kFieldTypeFloat)
+      return false;
+    f.type = (tFieldType)*q++;
+    if (!getFloat(q, end, res) || !(res > 0) || q >= end || *q > TELEMETRY_MAX_NAME || end - q < 1 + *q)
+      return false;
+    f.resolution = res;
+    f.decimals = f.type == tFieldType::kFieldTypeFixed && res < 1 ? (int)ceil(-log10(res) - 1e-6) : 0;
+    f.name.assign((const char *)q + 1, *q);
+    q += 1 + *q;
+    fields.push_back(f);
+  }
+
+  d.fields = fields;
+  d.prev.assign(count, 0);
+  d.time = 0;
+  d.haveKey = false;
+  p = q;
+  return true;
+}
+
+// parses a key or delta record into values, returns false if it is not valid
+static bool
+parseRecord(const uint8_t *&p, const uint8_t *end, decoder &d, std::vector<double> &values, uint64_t &dropped)
+{
+  const uint8_t *q = p;
+  bool key = *q++ == TELEMETRY_TAG_KEY;
+  if (d.fields.empty() || (!key && !d.haveKey))
+    return false;
+
+  uint64_t t, drops = 0;
+  if (!getVarint(q, end, t) || (key && !getVarint(q, end, drops)))
+    return false;
+  uint64_t time = key ? t : d.time + t;
+  if (key && time < d.time)
+    return false;
+
+  std::vector<int64_t> cur(d.prev);
+  values.resize(d.fields.size());
+  for (size_t i = 0; i < d.fields.size(); i++)
+  {
+    const field &f = d.fields[i];
+    if (f.type == tFieldType::kFieldTypeFloat)
+    {
+      float v;
+      if (!getFloat(q, end, v))
+        return false;
+      values[i] = v;
+      continue;
+    }
+    uint64_t z;
+    if (!getVarint(q, end, z))
+      return false;
+    cur[i] = key ? unzigzag(z) : d.prev[i] + unzigzag(z);
+    values[i] = f.type == tFieldType::kFieldTypeFixed ? cur[i] * (double)f.resolution : (double)cur[i];
+  }
+
+  // key records are 2 bytes of CRC, delta records its low byte
+  uint16_t crc = crc16(p, q - p);
+  if (end - q < (key ? 2 : 1) || q[0] != (uint8_t)crc || (key && q[1] != (uint8_t)(crc >> 8)))
+    return false;
+  q += key ? 2 : 1;
+
+  d.prev = cur;
+  d.time = time;
+  d.haveKey = true;
+  dropped += drops;
+  p = q;
+  return true;
+}
+
+static void
+formatValue(char *buf, size_t len, const field &f, double v)
+{
+  if (f.type == tFieldType::kFieldTypeFloat)
+    snprintf(buf, len, "%.9g", v);
+  else
+    snprintf(buf, len, "%.*f", f.decimals, v);
+}
+
+int main(int argc, char **argv)
+{
+  const char *prefix = nullptr;
+  const char *files[2] = {nullptr, nullptr};
+  int nfiles = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+      prefix = argv[++i];
+    else if (argv[i][0] != '-' && nfiles < 2)
+      files[nfiles++] = argv[i];
+    else
+      nfiles = 3;
+  }
+  if (nfiles < 1 || nfiles > 2 || (prefix != nullptr && nfiles != 1))
+  {
+    fprintf(stderr, "usage: telemetry2csv [-c prefix] log.tlm [out.csv]\n");
+    return 2;
+  }
+
+  FILE *fp = fopen(files[0], "rb");
+  if (fp == nullptr)
+  {
+    fprintf(stderr, "telemetry2csv: cannot read %s\n", files[0]);
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    data.insert(data.end(), buf, buf + n);
+  fclose(fp);
+
+  FILE *out = stdout;
+  if (prefix == nullptr && nfiles == 2 && (out = fopen(files[1], "w")) == nullptr)
+  {
+    fprintf(stderr, "telemetry2csv: cannot write %s\n", files[1]);
+    return 1;
+  }
+  std::map<std::string, FILE *> columns;
+  auto column = [&](const std::string &name) -> FILE *
+  {
+    FILE *&c = columns[name];
+    if (c == nullptr)
+    {
+      std::string path = std::string(prefix) + "." + name + ".txt";
+      if ((c = fopen(path.c_str(), "w")) == nullptr)
+      {
+        fprintf(stderr, "telemetry2csv: cannot write %s\n", path.c_str());
+        exit(1);
+      }
+    }
+    return c;
+  };
+
+  decoder d;
+  std::vector<double> values;
+  uint64_t records = 0, dropped = 0, skipped = 0, schemas = 0;
+  const uint8_t *p = data.data(), *end = p + data.size();
+  char text[64];
+
+  while (p < end)
+  {
+    bool ok = false;
+    if (*p == TELEMETRY_TAG_SCHEMA && parseSchema(p, end, d))
+    {
+      ok = true;
+      schemas++;
+      if (prefix == nullptr)
+      {
+        fprintf(out, "%stime_us", schemas > 1 ? "\n" : "");
+        for (const field &f : d.fields)
+          fprintf(out, ",%s", f.name.c_str());
+        fprintf(out, "\n");
+      }
+    }
+    else if ((*p == TELEMETRY_TAG_KEY || *p == TELEMETRY_TAG_DELTA) && parseRecord(p, end, d, values, dropped))
+    {
+      ok = true;
+      records++;
+      if (prefix == nullptr)
+      {
+        fprintf(out, "%llu", (unsigned long long)d.time);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+          formatValue(text, sizeof(text), d.fields[i], values[i]);
+          fprintf(out, ",%s", text);
+        }
+        fprintf(out, "\n");
+      }
+      else
+      {
+        fprintf(column("time_us"), "%llu\n", (unsigned long long)d.time);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+          formatValue(text, sizeof(text), d.fields[i], values[i]);
+          fprintf(column(d.fields[i].name), "%s\n", text);
+        }
+      }
+    }
+
+    // resynchronize on the next schema or key record with a matching CRC
+    if (!ok)
+    {
+      d.haveKey = false;
+      p++;
+      skipped++;
+    }
+  }
+
+  if (out != stdout)
+    fclose(out);
+  for (auto &c : columns)
+    fclose(c.second);
+
+  fprintf(stderr, "%llu records, %llu dropped on the brain", (unsigned long long)records, (unsigned long long)dropped);
+  if (skipped > 0)
+    fprintf(stderr, ", %llu damaged bytes skipped", (unsigned long long)skipped);
+  fprintf(stderr, "\n");
+  return 0;
+}
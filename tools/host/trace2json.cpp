@@ -0,0 +1,224 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     trace2json.cpp                                              */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    trace2json.cpp
+ * @brief   Converts vex::trace files to the Chrome trace event format
+ * @details
+ *  Reads a trace written by vex::trace, see vex_traceformat.h, from the SD
+ *  card or captured from the serial port, and writes JSON that
+ *  chrome://tracing and ui.perfetto.dev open.  Each task is a thread of one
+ *  process, scopes are begin and end events and marks are instant events.
+ *  Bytes that are not an intact block, such as printf output in a serial
+ *  capture, are skipped.  Scopes still open at the end are ended at the
+ *  last event.  Skipped bytes and events dropped on the brain are reported
+ *  on stderr, drops also appear as instant events.
+ *
+ *    trace2json trace.trc [out.json]
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "vex_traceformat.h"
+
+using namespace vex::traceformat;
+
+struct thread
+{
+  int64_t task = -1;
+  std::string name;
+  uint32_t depth = 0;
+};
+
+static FILE *out;
+static bool first = true;
+
+static std::string
+quote(const std::string &s)
+{
+  std::string q = "\"";
+  for (unsigned char c : s)
+  {
+    if (c == '"' || c == '\\')
+      q += '\\', q += c;
+    else if (c < 0x20)
+    {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", c);
+      q += buf;
+    }
+    else
+      q += c;
+  }
+  return q + "\"";
+}
+
+static void
+event(const char *ph, const std::string &name, uint64_t time, int64_t tid, const char *extra = "")
+{
+  fprintf(out, "%s\n{\"ph\":\"%s\",\"pid\":1,\"tid\":%" PRId64 ",\"ts\":%" PRIu64, first ? "" : ",", ph, tid, time);
+  if (!name.empty())
+    fprintf(out, ",\"name\":%s", quote(name).c_str());
+  fprintf(out, "%s}", extra);
+  first = false;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2 || argc > 3)
+  {
+    fprintf(stderr, "usage: trace2json trace.trc [out.json]\n");
+    return 2;
+  }
+
+  FILE *fp = fopen(argv[1], "rb");
+  if (fp == nullptr)
+  {
+    fprintf(stderr, "trace2json: cannot read %s\n", argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    data.insert(data.end(), buf, buf + n);
+  fclose(fp);
+
+  out = argc == 3 ? fopen(argv[2], "w") : stdout;
+  if (out == nullptr)
+  {
+    fprintf(stderr, "trace2json: cannot write %s\n", argv[2]);
+    return 1;
+  }
+  fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  fprintf(out, "\n{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"V5 brain\"}}");
+  first = false;
+
+  // threads are keyed by task id, the ring index can be reused by another task
+  std::map<int64_t, thread> threads;
+  std::map<int64_t, std::string> named;
+  uint64_t last = 0, events = 0, dropped = 0, skipped = 0, damaged = 0;
+  const uint8_t *p = data.data(), *end = p + data.size();
+
+  while (p < end)
+  {
+    int32_t len = getBlock(p, end);
+    if (len < 0)
+    {
+      p++;
+      skipped++;
+      continue;
+    }
+    const uint8_t *q = p + TRACE_HEADER_SIZE, *qend = q + len;
+    p = qend;
+
+    uint64_t time;
+    if (!getVarint(q, qend, time))
+    {
+      damaged++;
+      continue;
+    }
+    std::map<uint32_t, std::string> names;
+    int64_t tasks[256];
+    for (int64_t &t : tasks)
+      t = -1;
+
+    while (q < qend)
+    {
+      uint8_t tag = *q++;
+      uint64_t a, b;
+      if (tag == TRACE_TAG_NAME)
+      {
+        if (!getVarint(q, qend, a) || q >= qend || qend - q < 1 + *q)
+          break;
+        names[(uint32_t)a] = std::string((const char *)q + 1, *q);
+        q += 1 + *q;
+        continue;
+      }
+      if (q >= qend)
+        break;
+      uint8_t ring = *q++;
+      if (tag == TRACE_TAG_THREAD)
+      {
+        if (!getVarint(q, qend, a) || q >= qend || qend - q < 1 + *q)
+          break;
+        std::string name((const char *)q + 1, *q);
+        q += 1 + *q;
+        tasks[ring] = (int64_t)a;
+        thread &t = threads[(int64_t)a];
+        t.task = (int64_t)a;
+        if (name.empty())
+          name = "task " + std::to_string(a);
+        if (named[t.task] != name)
+        {
+          std::string args = ",\"args\":{\"name\":" + quote(name) + "}";
+          event("M", "thread_name", 0, t.task, args.c_str());
+          named[t.task] = name;
+        }
+        continue;
+      }
+      if (tasks[ring] < 0)
+        break;
+      thread &t = threads[tasks[ring]];
+      if (tag == TRACE_TAG_DROPPED)
+      {
+        if (!getVarint(q, qend, a))
+          break;
+        dropped += a;
+        std::string name = "dropped " + std::to_string(a);
+        event("i", name, time, t.task, ",\"s\":\"t\"");
+        continue;
+      }
+      if (tag != TRACE_TAG_BEGIN && tag != TRACE_TAG_END && tag != TRACE_TAG_MARK)
+        break;
+      if (!getVarint(q, qend, a) || (tag != TRACE_TAG_END && !getVarint(q, qend, b)))
+        break;
+      time += a;
+      last = time;
+      events++;
+      if (tag == TRACE_TAG_BEGIN)
+      {
+        event("B", names[(uint32_t)b], time, t.task);
+        t.depth++;
+      }
+      else if (tag == TRACE_TAG_MARK)
+        event("i", names[(uint32_t)b], time, t.task, ",\"s\":\"t\"");
+      else if (t.depth > 0)
+      {
+        event("E", "", time, t.task);
+        t.depth--;
+      }
+    }
+    if (q < qend)
+      damaged++;
+  }
+
+  for (auto &t : threads)
+    for (; t.second.depth > 0; t.second.depth--)
+      event("E", "", last, t.first);
+  fprintf(out, "\n]}\n");
+  if (out != stdout)
+    fclose(out);
+
+  fprintf(stderr, "%" PRIu64 " events, %zu tasks, %.3f s", events, threads.size(), last / 1e6);
+  if (dropped > 0)
+    fprintf(stderr, ", %" PRIu64 " dropped on the brain", dropped);
+  if (skipped > 0 || damaged > 0)
+    fprintf(stderr, ", %" PRIu64 " bytes skipped, %" PRIu64 " damaged blocks", skipped, damaged);
+  fprintf(stderr, "\n");
+  return 0;
+}
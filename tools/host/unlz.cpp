@@ -0,0 +1,166 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     unlz.cpp                                                    */
+/*    Author:     Voidless7125                                                */
+/*    Created:    19 Oct 2026                                                 */
+/*                                                                            */
+/*    Revisions:                                                              */
+/*                V1.00     TBD - Initial release                             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    unlz.cpp
+ * @brief   Decompresses logs written by sdlogger with compression
+ * @details
+ *  Reads the blocks described in vex_lzformat.h and writes the original log.
+ *  Blocks that fail to decompress or do not match their CRC are skipped up
+ *  to the next block header and reported on stderr.  With -z a file is compressed in SDLOGGER_BUFFER_SIZE blocks, the
+ *  same way the brain does, to check the ratio of an existing log.
+ *
+ *    unlz [-z] in [out]
+ */
+/*---------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "vex_lzformat.h"
+
+using namespace vex::lzformat;
+
+// matches SDLOGGER_BUFFER_SIZE in vex_sdlogger.h
+#define UNLZ_BLOCK (16 * 512)
+
+static bool
+readFile(const char *name, std::vector<uint8_t> &data)
+{
+  FILE *fp = fopen(name, "rb");
+  if (fp == nullptr)
+    return false;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    data.insert(data.end(), buf, buf + n);
+  fclose(fp);
+  return true;
+}
+
+static void
+pack(const std::vector<uint8_t> &in, std::vector<uint8_t> &out)
+{
+  static uint16_t table[LZ_TABLE_SIZE];
+  uint8_t block[LZ_HEADER_SIZE + UNLZ_BLOCK];
+  auto start = std::chrono::steady_clock::now();
+
+  for (size_t pos = 0; pos < in.size(); pos += UNLZ_BLOCK)
+  {
+    uint32_t len = in.size() - pos < UNLZ_BLOCK ? in.size() - pos : UNLZ_BLOCK;
+    uint32_t packed = compress(in.data() + pos, len, block + LZ_HEADER_SIZE, len - 1, table);
+    if (packed == 0)
+      memcpy(block + LZ_HEADER_SIZE, in.data() + pos, len);
+    putHeader(block, len, packed > 0 ? packed : len, packed == 0, vex::crc::crc32(in.data() + pos, len));
+    out.insert(out.end(), block, block + LZ_HEADER_SIZE + (packed > 0 ? packed : len));
+  }
+
+  double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  fprintf(stderr, "%zu -> %zu bytes (%.1f%%), %.0f MB/s\n", in.size(), out.size(),
+          in.empty() ? 0.0 : 100.0 * out.size() / in.size(), s > 0 ? in.size() / s / 1e6 : 0.0);
+}
+
+static void
+unpack(const std::vector<uint8_t> &in, std::vector<uint8_t> &out)
+{
+  uint8_t block[LZ_MAX_BLOCK];
+  uint32_t blocks = 0, damaged = 0;
+  size_t skipped = 0;
+  size_t pos = 0;
+
+  while (pos < in.size())
+  {
+    uint32_t size, packed, crc;
+    bool stored;
+    bool ok = in.size() - pos >= LZ_HEADER_SIZE && getHeader(in.data() + pos, size, packed, stored, crc) &&
+              in.size() - pos - LZ_HEADER_SIZE >= packed;
+    if (ok)
+    {
+      const uint8_t *data = in.data() + pos + LZ_HEADER_SIZE;
+      if (!stored)
+      {
+        ok = decompress(data, packed, block, sizeof(block)) == (int32_t)size;
+        data = block;
+      }
+      ok = ok && vex::crc::crc32(data, size) == crc;
+      if (ok)
+        out.insert(out.end(), data, data + size);
+    }
+
+    if (ok)
+    {
+      pos += LZ_HEADER_SIZE + packed;
+      blocks++;
+      continue;
+    }
+
+    // resynchronize on the next block header
+    size_t next = pos + 1;
+    while (next + 4 <= in.size() && (in[next] | (in[next + 1] << 8) | (in[next + 2] << 16) |
+                                     ((uint32_t)in[next + 3] << 24)) != LZ_MAGIC)
+      next++;
+    if (next + 4 > in.size())
+      next = in.size();
+    skipped += next - pos;
+    damaged++;
+    pos = next;
+  }
+
+  fprintf(stderr, "%u blocks, %zu -> %zu bytes", blocks, in.size(), out.size());
+  if (damaged > 0)
+    fprintf(stderr, ", %u damaged, %zu bytes skipped", damaged, skipped);
+  fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv)
+{
+  bool z = false;
+  const char *files[2] = {nullptr, nullptr};
+  int nfiles = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-z") == 0)
+      z = true;
+    else if (argv[i][0] != '-' && nfiles < 2)
+      files[nfiles++] = argv[i];
+    else
+      nfiles = 3;
+  }
+  if (nfiles < 1 || nfiles > 2)
+  {
+    fprintf(stderr, "usage: unlz [-z] in [out]\n");
+    return 2;
+  }
+
+  std::vector<uint8_t> in, out;
+  if (!readFile(files[0], in))
+  {
+    fprintf(stderr, "unlz: cannot read %s\n", files[0]);
+    return 1;
+  }
+  if (z)
+    pack(in, out);
+  else
+    unpack(in, out);
+
+  FILE *fp = nfiles == 2 ? fopen(files[1], "wb") : stdout;
+  if (fp == nullptr)
+  {
+    fprintf(stderr, "unlz: cannot write %s\n", files[1]);
+    return 1;
+  }
+  fwrite(out.data(), 1, out.size(), fp);
+  if (fp != stdout)
+    fclose(fp);
+  return 0;
+}